@@ -488,9 +488,12 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
 	if (skip_buffer && to_read > 0) {
 		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
-		hfh.buffer_available = 0;
-		hfh.buffer_idx = 0;
-		hfh.file_offset = location + nr_bytes;
+		if (!hfh.flags.RequireParallelAccess()) {
+			// with parallel access multiple threads read from the handle at the same time: leave its state alone
+			hfh.buffer_available = 0;
+			hfh.buffer_idx = 0;
+			hfh.file_offset = location + nr_bytes;
+		}
 		return;
 	}
 
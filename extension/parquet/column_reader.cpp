@@ -202,7 +202,7 @@ void ColumnReader::Offsets(uint32_t *offsets, uint8_t *defines, idx_t num_values
 	throw NotImplementedException("Offsets");
 }
 
-void ColumnReader::PrepareDeltaLengthByteArray(ResizeableBuffer &buffer) {
+void ColumnReader::PrepareDeltaLengthByteArray(shared_ptr<ResizeableBuffer> &buffer) {
 	throw std::runtime_error("DELTA_LENGTH_BYTE_ARRAY encoding is only supported for text or binary data");
 }
 
@@ -217,6 +217,10 @@ void ColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, // NOLINT
 
 void ColumnReader::DictReference(Vector &result) {
 }
+bool ColumnReader::EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, // NOLINT
+                                        Vector &result) {
+	return false;
+}
 void ColumnReader::PlainReference(shared_ptr<ByteBuffer>, Vector &result) { // NOLINT
 }
 
@@ -238,16 +242,22 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// skips of the rows at the end of the previous row group (if any) are never applied
+	pending_skips = 0;
+	page_rows_available = 0;
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
+	PageHeader page_hdr;
+	reader.Read(page_hdr, *protocol);
+	PreparePageHeader(page_hdr);
+}
+
+void ColumnReader::PreparePageHeader(PageHeader &page_hdr) {
 	dict_decoder.reset();
 	defined_decoder.reset();
 	bss_decoder.reset();
 	block.reset();
-	PageHeader page_hdr;
-	reader.Read(page_hdr, *protocol);
-
 	switch (page_hdr.type) {
 	case PageType::DATA_PAGE_V2:
 		PreparePageV2(page_hdr);
@@ -459,7 +469,7 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 		break;
 	}
 	case Encoding::DELTA_LENGTH_BYTE_ARRAY: {
-		PrepareDeltaLengthByteArray(*block);
+		PrepareDeltaLengthByteArray(block);
 		break;
 	}
 	case Encoding::DELTA_BYTE_ARRAY: {
@@ -497,6 +507,24 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 	auto to_read = num_values;
 
 	while (to_read > 0) {
+		if (page_rows_available == 0 && !HasRepeats()) {
+			// none of the next rows might have survived the filters of the scan: we do not need to read (or even
+			// decompress) the pages that only contain such rows
+			idx_t filtered_count = 0;
+			while (filtered_count < to_read && !filter.test(result_offset + filtered_count)) {
+				filtered_count++;
+			}
+			auto skipped = filtered_count > 0 ? SkipPages(filtered_count) : 0;
+			if (skipped > 0) {
+				if (HasDefines()) {
+					// the skipped rows are filtered out anyway - mark them as NULL
+					memset(define_out + result_offset, 0, skipped);
+				}
+				result_offset += skipped;
+				to_read -= skipped;
+				continue;
+			}
+		}
 		while (page_rows_available == 0) {
 			PrepareRead(filter);
 		}
@@ -530,9 +558,15 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+			// if the whole vector is read from a single page we can emit the offsets as a dictionary vector
+			// when skipping rows (i.e. none of the rows are needed) the vector is not used at all
+			const bool emit_dictionary =
+			    allow_dictionary_vectors && result_offset == 0 && read_now == num_values && filter.any();
+			if (!emit_dictionary || !EmitDictionaryVector(offsets, define_out, read_now, result)) {
+				DictReference(result);
+				Offsets(offsets, define_out, read_now, filter, result_offset, result);
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
@@ -600,8 +634,45 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (HasRepeats() || reader.parquet_options.encryption_config) {
+		// with repeats a page does not contain a whole number of rows
+		// encrypted pages are not stored with their compressed size, so we cannot seek over them
+		return 0;
+	}
+	// the transport is already positioned at the next page by the caller
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+
+	idx_t skipped = 0;
+	while (page_rows_available == 0 && skipped < num_values) {
+		PageHeader page_hdr;
+		reader.Read(page_hdr, *protocol);
+
+		idx_t page_values = 0;
+		if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+			page_values = NumericCast<idx_t>(page_hdr.data_page_header.num_values);
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+			page_values = NumericCast<idx_t>(page_hdr.data_page_header_v2.num_values);
+		}
+		if (page_values > 0 && skipped + page_values <= num_values) {
+			// all rows of this page are skipped: seek over the page data without reading or decompressing it
+			trans.SetLocation(trans.GetLocation() + NumericCast<idx_t>(page_hdr.compressed_page_size));
+			skipped += page_values;
+			continue;
+		}
+		// we need (part of) this page, or it is a dictionary page
+		PreparePageHeader(page_hdr);
+	}
+	chunk_read_offset = trans.GetLocation();
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
+	// skip over entire pages first - only the rows in the remaining partial page have to be decoded
+	auto skipped = SkipPages(num_values);
+	group_rows_available -= skipped;
+	num_values -= skipped;
 
 	dummy_define.zero();
 	dummy_repeat.zero();
@@ -626,6 +697,16 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 //===--------------------------------------------------------------------===//
 // String Column Reader
 //===--------------------------------------------------------------------===//
+class ParquetStringVectorBuffer : public VectorBuffer {
+public:
+	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
+	}
+
+private:
+	shared_ptr<ByteBuffer> buffer;
+};
+
 StringColumnReader::StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p,
                                        idx_t schema_idx_p, idx_t max_define_p, idx_t max_repeat_p)
     : TemplatedColumnReader<string_t, StringParquetValueConversion>(reader, std::move(type_p), schema_p, schema_idx_p,
@@ -659,7 +740,9 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
-	dict_strings = unsafe_unique_ptr<string_t[]>(new string_t[num_entries]);
+	dict_vector = make_uniq<Vector>(Type(), num_entries + 1);
+	dict_strings = FlatVector::GetData<string_t>(*dict_vector);
+	dict_entry_count = num_entries;
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
 		if (fixed_width_string_length == 0) {
@@ -676,6 +759,8 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 		dict_strings[dict_idx] = string_t(dict_str, actual_str_len);
 		dict->inc(str_len);
 	}
+	FlatVector::SetNull(*dict_vector, num_entries, true);
+	StringVector::AddBuffer(*dict_vector, make_buffer<ParquetStringVectorBuffer>(dict));
 }
 
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
@@ -689,9 +774,9 @@ static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, Resizeable
 	return result;
 }
 
-void StringColumnReader::PrepareDeltaLengthByteArray(ResizeableBuffer &buffer) {
+void StringColumnReader::PrepareDeltaLengthByteArray(shared_ptr<ResizeableBuffer> &buffer) {
 	idx_t value_count;
-	auto length_buffer = ReadDbpData(reader.allocator, buffer, value_count);
+	auto length_buffer = ReadDbpData(reader.allocator, *buffer, value_count);
 	if (value_count == 0) {
 		// no values
 		byte_array_data = make_uniq<Vector>(LogicalType::VARCHAR, nullptr);
@@ -701,15 +786,15 @@ void StringColumnReader::PrepareDeltaLengthByteArray(ResizeableBuffer &buffer) {
 	byte_array_data = make_uniq<Vector>(LogicalType::VARCHAR, value_count);
 	byte_array_count = value_count;
 	delta_offset = 0;
+	// the values are stored back-to-back in the page: point the strings into the page instead of copying them
 	auto string_data = FlatVector::GetData<string_t>(*byte_array_data);
 	for (idx_t i = 0; i < value_count; i++) {
 		auto str_len = length_data[i];
-		string_data[i] = StringVector::EmptyString(*byte_array_data, str_len);
-		auto result_data = string_data[i].GetDataWriteable();
-		memcpy(result_data, buffer.ptr, length_data[i]);
-		buffer.inc(length_data[i]);
-		string_data[i].Finalize();
+		buffer->available(str_len);
+		string_data[i] = string_t(char_ptr_cast(buffer->ptr), str_len);
+		buffer->inc(str_len);
 	}
+	StringVector::AddBuffer(*byte_array_data, make_buffer<ParquetStringVectorBuffer>(buffer));
 }
 
 void StringColumnReader::PrepareDeltaByteArray(ResizeableBuffer &buffer) {
@@ -773,16 +858,6 @@ void StringColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, parq
 	StringVector::AddHeapReference(result, *byte_array_data);
 }
 
-class ParquetStringVectorBuffer : public VectorBuffer {
-public:
-	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
-	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
-	}
-
-private:
-	shared_ptr<ByteBuffer> buffer;
-};
-
 void StringColumnReader::DictReference(Vector &result) {
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(dict));
 }
@@ -790,6 +865,31 @@ void StringColumnReader::PlainReference(shared_ptr<ByteBuffer> plain_data, Vecto
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(std::move(plain_data)));
 }
 
+bool StringColumnReader::EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) {
+	if (!dict_vector) {
+		throw IOException(
+		    "Parquet file is likely corrupted, cannot have dictionary offsets without seeing a dictionary first.");
+	}
+	// the last entry of the dictionary vector is NULL
+	const auto null_entry = dict_entry_count;
+	SelectionVector sel(num_values);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			sel.set_index(row_idx, null_entry);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= null_entry) {
+			throw IOException("Parquet file is likely corrupted, dictionary offset out of range");
+		}
+		sel.set_index(row_idx, offset);
+	}
+	result.Slice(*dict_vector, sel, num_values);
+	DictionaryVector::SetDictionarySize(result, null_entry + 1);
+	return true;
+}
+
 string_t StringParquetValueConversion::DictRead(ByteBuffer &dict, uint32_t &offset, ColumnReader &reader) {
 	return reader.Cast<StringColumnReader>().dict_strings[offset];
 }
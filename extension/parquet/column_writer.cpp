@@ -1,8 +1,11 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_writer.hpp"
 #include "geo_parquet.hpp"
 #ifndef DUCKDB_AMALGAMATION
@@ -12,6 +15,7 @@
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/serializer/write_stream.hpp"
 #include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/timestamp.hpp"
@@ -88,6 +92,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -334,6 +341,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of the values in this page
+	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -356,6 +365,10 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The hashes of the distinct values of the column chunk - only set if we write a Bloom filter for the column
+	unique_ptr<unordered_set<uint64_t>> bloom_filter_hashes;
+	//! The Bloom filter of the column chunk, created from the hashes when we finish writing the column chunk
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -391,6 +404,7 @@ public:
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -398,6 +412,11 @@ protected:
 	                        idx_t start_offset, idx_t count);
 
 	virtual duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state);
+	//! The encoding of a page after it has been flushed - by default the encoding of the column chunk
+	virtual duckdb_parquet::format::Encoding::type GetPageEncoding(BasicColumnWriterState &state,
+	                                                               ColumnWriterPageState *page_state) {
+		return GetEncoding(state);
+	}
 
 	void NextPage(BasicColumnWriterState &state);
 	void FlushPage(BasicColumnWriterState &state);
@@ -417,6 +436,15 @@ protected:
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
 
+	//! Whether or not we can write a Bloom filter for the values of this column. Only used for scalar types.
+	virtual bool SupportsBloomFilter() const {
+		return false;
+	}
+	//! Adds the hashes of the plain encoded (non-NULL) values of a vector to the Bloom filter hashes of the chunk
+	virtual void HashVector(Vector &vector, idx_t count, unordered_set<uint64_t> &hashes) {
+		throw InternalException("HashVector unsupported for this column writer");
+	}
+
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
 	}
@@ -427,6 +455,10 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+	//! Registers the page index of the column chunk with the writer
+	void RegisterPageIndex(BasicColumnWriterState &state, duckdb_parquet::format::OffsetIndex offset_index);
+	//! Writes the Bloom filter of the column chunk
+	void FlushBloomFilter(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column_chunk);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -463,6 +495,9 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	const auto page_size = writer.PageSizeBytes().IsValid()
+	                           ? MinValue<idx_t>(writer.PageSizeBytes().GetIndex(), MAX_UNCOMPRESSED_PAGE_SIZE)
+	                           : MAX_UNCOMPRESSED_PAGE_SIZE;
 	idx_t vector_index = 0;
 	reference<PageInformation> page_info_ref = state.page_info.back();
 	for (idx_t i = start; i < vcount; i++) {
@@ -475,7 +510,7 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= page_size) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -495,6 +530,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (SupportsBloomFilter() && writer.HasBloomFilter(schema_path)) {
+		state.bloom_filter_hashes = make_uniq<unordered_set<uint64_t>>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -520,6 +558,7 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		write_info.stats_state = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -590,6 +629,7 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	hdr.data_page_header.encoding = GetPageEncoding(state, write_info.page_state.get());
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -609,6 +649,8 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 		D_ASSERT(write_info.compressed_buf.get() == write_info.compressed_data);
 		write_info.temp_writer.reset();
 	}
+
+	state.stats_state->Merge(*write_info.stats_state);
 }
 
 unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
@@ -622,6 +664,9 @@ idx_t BasicColumnWriter::GetRowSize(const Vector &vector, const idx_t index,
 
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter_hashes) {
+		HashVector(vector, count, *state.bloom_filter_hashes);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -634,7 +679,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.stats_state.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
 
 		write_info.write_count += write_count;
@@ -681,39 +726,62 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.__isset.statistics = true;
 	}
+	auto &encodings = column_chunk.meta_data.encodings;
 	for (const auto &write_info : state.write_info) {
-		column_chunk.meta_data.encodings.push_back(write_info.page_header.data_page_header.encoding);
+		// the encodings are a set - pages of the same chunk can have different encodings
+		auto encoding = write_info.page_header.data_page_header.encoding;
+		if (std::find(encodings.begin(), encodings.end(), encoding) == encodings.end()) {
+			encodings.push_back(encoding);
+		}
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::FinishWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
 	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
+	// flush the dictionary - the dictionary page is inserted before the data pages
+	if (HasDictionary(state)) {
+		FlushDictionary(state, state.stats_state.get());
+	}
+	SetParquetStatistics(state, column_chunk);
+
+	if (state.bloom_filter_hashes && !state.bloom_filter_hashes->empty()) {
+		auto &hashes = *state.bloom_filter_hashes;
+		auto num_bytes = ParquetBloomFilter::OptimalSize(hashes.size(), writer.BloomFilterFalsePositiveRatio());
+		state.bloom_filter = make_uniq<ParquetBloomFilter>(Allocator::DefaultAllocator(), num_bytes);
+		for (auto &hash : hashes) {
+			state.bloom_filter->FilterInsert(hash);
+		}
+	}
+	state.bloom_filter_hashes.reset();
+}
+
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	auto &column_chunk = state.row_group.columns[state.col_idx];
+
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
-	// flush the dictionary
 	if (HasDictionary(state)) {
-		column_chunk.meta_data.statistics.distinct_count = UnsafeNumericCast<int64_t>(DictionarySize(state));
-		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.dictionary_page_offset = UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten());
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 	}
 
 	// record the start position of the pages for this column
 	column_chunk.meta_data.data_page_offset = 0;
-	SetParquetStatistics(state, column_chunk);
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::format::OffsetIndex offset_index;
 	for (auto &write_info : state.write_info) {
+		auto is_data_page = write_info.page_header.type == PageType::DATA_PAGE ||
+		                    write_info.page_header.type == PageType::DATA_PAGE_V2;
 		// set the data page offset whenever we see the *first* data page
-		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
-		                                                     write_info.page_header.type == PageType::DATA_PAGE_V2)) {
+		if (column_chunk.meta_data.data_page_offset == 0 && is_data_page) {
 			column_chunk.meta_data.data_page_offset = UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten());
 			;
 		}
@@ -724,10 +792,78 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (is_data_page) {
+			auto &page_info = state.page_info[offset_index.page_locations.size()];
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = UnsafeNumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    UnsafeNumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = UnsafeNumericCast<int64_t>(page_info.offset);
+			offset_index.page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	// the Bloom filter is written directly after the pages of the column chunk
+	if (state.bloom_filter) {
+		FlushBloomFilter(state, column_chunk);
+	}
+
+	// a page index only pays off over the column chunk statistics if there are multiple pages
+	// for repeated columns the pages do not necessarily start at a row boundary, so we cannot write an offset index
+	if (max_repeat == 0 && offset_index.page_locations.size() > 1) {
+		RegisterPageIndex(state, std::move(offset_index));
+	}
+}
+
+void BasicColumnWriter::RegisterPageIndex(BasicColumnWriterState &state,
+                                          duckdb_parquet::format::OffsetIndex offset_index) {
+	// the column index contains the min/max of every page that has (non-NULL) values
+	// we only write it if we have these statistics for all of them (e.g. not for dictionary encoded strings)
+	auto column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+	column_index->boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type != PageType::DATA_PAGE) {
+			continue;
+		}
+		auto &page_info = state.page_info[page_idx++];
+		idx_t null_count = 0;
+		if (!state.definition_levels.empty()) {
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				null_count += state.definition_levels[i] != max_define;
+			}
+		}
+		auto &page_stats = *write_info.stats_state;
+		bool null_page = null_count == page_info.row_count;
+		if (!null_page && !page_stats.HasStats()) {
+			column_index.reset();
+			break;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+		column_index->null_counts.push_back(UnsafeNumericCast<int64_t>(null_count));
+	}
+	writer.AddPageIndex(state.col_idx, std::move(column_index), std::move(offset_index));
+}
+
+void BasicColumnWriter::FlushBloomFilter(BasicColumnWriterState &state,
+                                         duckdb_parquet::format::ColumnChunk &column_chunk) {
+	auto &bloom_filter = *state.bloom_filter;
+	auto &column_writer = writer.GetWriter();
+	auto bloom_filter_offset = column_writer.GetTotalWritten();
+	ParquetBloomFilterHeader header;
+	header.num_bytes = NumericCast<int32_t>(bloom_filter.GetSize());
+	writer.Write(header);
+	writer.WriteData(bloom_filter.GetData(), NumericCast<uint32_t>(bloom_filter.GetSize()));
+	column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+	column_chunk.meta_data.__set_bloom_filter_length(
+	    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -797,6 +933,16 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -900,6 +1046,18 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, cons
 	ser.WriteData(const_data_ptr_cast(write_combiner), write_combiner_count * sizeof(TGT));
 }
 
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	explicit StandardWriterPageState(duckdb_parquet::format::Encoding::type encoding) : encoding(encoding) {
+	}
+
+	//! The encoding of the page - pages that do not become smaller using it are written as PLAIN instead
+	duckdb_parquet::format::Encoding::type encoding;
+	//! The non-NULL values of the page - they are encoded when the page is flushed
+	unsafe_vector<TGT> values;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -914,10 +1072,123 @@ public:
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state) override {
+		if (writer.GetParquetVersion() == ParquetVersion::V1) {
+			// the encodings below are not supported by all readers
+			return Encoding::PLAIN;
+		}
+		if (std::is_integral<TGT>::value && (sizeof(TGT) == sizeof(int32_t) || sizeof(TGT) == sizeof(int64_t))) {
+			// sorted or clustered integers (e.g. dates, timestamps or identifiers) have small deltas
+			return Encoding::DELTA_BINARY_PACKED;
+		}
+		if (std::is_floating_point<TGT>::value && writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the bytes of floating point values does not make the page smaller,
+			// but it can make the page much more compressible
+			return Encoding::BYTE_STREAM_SPLIT;
+		}
+		return Encoding::PLAIN;
+	}
+
+	duckdb_parquet::format::Encoding::type GetPageEncoding(BasicColumnWriterState &state,
+	                                                       ColumnWriterPageState *page_state) override {
+		if (!page_state) {
+			return Encoding::PLAIN;
+		}
+		return page_state->Cast<StandardWriterPageState<TGT>>().encoding;
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+		auto encoding = GetEncoding(state);
+		if (encoding == Encoding::PLAIN) {
+			// plain pages are written directly
+			return nullptr;
+		}
+		return make_uniq<StandardWriterPageState<TGT>>(encoding);
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		if (!state_p) {
+			return;
+		}
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		auto &values = page_state.values;
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED: {
+			using DELTA_TYPE = typename std::conditional<sizeof(TGT) == sizeof(int32_t), int32_t, int64_t>::type;
+			MemoryStream delta_stream(MaxValue<idx_t>(NextPowerOfTwo(values.size() * sizeof(TGT)),
+			                                          MemoryStream::DEFAULT_INITIAL_CAPACITY));
+			DbpEncoder::Encode<DELTA_TYPE>(delta_stream, reinterpret_cast<const DELTA_TYPE *>(values.data()),
+			                               values.size());
+			if (delta_stream.GetPosition() < values.size() * sizeof(TGT)) {
+				temp_writer.WriteData(delta_stream.GetData(), delta_stream.GetPosition());
+				return;
+			}
+			// the deltas are not smaller than the values themselves
+			page_state.encoding = Encoding::PLAIN;
+			temp_writer.WriteData(const_data_ptr_cast(values.data()), values.size() * sizeof(TGT));
+			break;
+		}
+		case Encoding::BYTE_STREAM_SPLIT: {
+			// only split the bytes if the page compresses better that way
+			MemoryStream plain_stream(
+			    MaxValue<idx_t>(NextPowerOfTwo(values.size() * sizeof(TGT)), MemoryStream::DEFAULT_INITIAL_CAPACITY));
+			plain_stream.WriteData(const_data_ptr_cast(values.data()), values.size() * sizeof(TGT));
+			MemoryStream split_stream(
+			    MaxValue<idx_t>(NextPowerOfTwo(values.size() * sizeof(TGT)), MemoryStream::DEFAULT_INITIAL_CAPACITY));
+			BssEncoder::Encode<TGT>(split_stream, values.data(), values.size());
+
+			size_t plain_size, split_size;
+			data_ptr_t compressed_data;
+			unique_ptr<data_t[]> compressed_buf;
+			CompressPage(plain_stream, plain_size, compressed_data, compressed_buf);
+			CompressPage(split_stream, split_size, compressed_data, compressed_buf);
+			if (split_size < plain_size) {
+				temp_writer.WriteData(split_stream.GetData(), split_stream.GetPosition());
+				return;
+			}
+			page_state.encoding = Encoding::PLAIN;
+			temp_writer.WriteData(plain_stream.GetData(), plain_stream.GetPosition());
+			break;
+		}
+		default:
+			throw InternalException("Unsupported encoding for StandardColumnWriter");
+		}
+	}
+
 	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (!page_state) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		// buffer the values so we can encode the entire page when flushing it
+		auto &values = page_state->Cast<StandardWriterPageState<TGT>>().values;
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+			values.push_back(target_value);
+		}
+	}
+
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void HashVector(Vector &vector, idx_t count, unordered_set<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(vector);
+		const auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			hashes.insert(ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+		}
 	}
 
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
@@ -953,6 +1224,12 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1084,6 +1361,14 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1307,6 +1592,24 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (values_too_big) {
+			return;
+		}
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1333,8 +1636,9 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values,
+	                      duckdb_parquet::format::Encoding::type encoding)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false), encoding(encoding) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
@@ -1346,6 +1650,12 @@ public:
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+	//! The encoding of the page - non-dictionary pages that do not become smaller by delta encoding the string
+	//! lengths are written as PLAIN instead
+	duckdb_parquet::format::Encoding::type encoding;
+	//! The lengths and the contents of the strings of a non-dictionary page - they are encoded when flushing the page
+	unsafe_vector<uint32_t> lengths;
+	MemoryStream string_data;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1461,7 +1771,7 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
-		} else {
+		} else if (page_state.encoding == Encoding::PLAIN) {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
 				if (!mask.RowIsValid(r)) {
@@ -1471,12 +1781,37 @@ public:
 				temp_writer.Write<uint32_t>(ptr[r].GetSize());
 				temp_writer.WriteData(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize());
 			}
+		} else {
+			// delta length page: the lengths are written before the strings, so buffer both
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				page_state.lengths.push_back(ptr[r].GetSize());
+				page_state.string_data.WriteData(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize());
+			}
+		}
+	}
+
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void HashVector(Vector &vector, idx_t count, unordered_set<uint64_t> &hashes) override {
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<string_t>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			hashes.insert(ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
 		}
 	}
 
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, GetEncoding(state));
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
@@ -1489,12 +1824,41 @@ public:
 				return;
 			}
 			page_state.encoder.FinishWrite(temp_writer);
+			return;
+		}
+		if (page_state.encoding == Encoding::PLAIN) {
+			// plain pages are written directly
+			return;
+		}
+		auto &lengths = page_state.lengths;
+		auto string_data = page_state.string_data.GetData();
+		MemoryStream length_stream;
+		DbpEncoder::Encode<int32_t>(length_stream, reinterpret_cast<const int32_t *>(lengths.data()), lengths.size());
+		if (length_stream.GetPosition() < lengths.size() * STRING_LENGTH_SIZE) {
+			// DELTA_LENGTH_BYTE_ARRAY: the encoded lengths followed by the concatenated strings
+			temp_writer.WriteData(length_stream.GetData(), length_stream.GetPosition());
+			temp_writer.WriteData(string_data, page_state.string_data.GetPosition());
+			return;
+		}
+		page_state.encoding = Encoding::PLAIN;
+		for (auto &length : lengths) {
+			temp_writer.Write<uint32_t>(length);
+			temp_writer.WriteData(string_data, length);
+			string_data += length;
 		}
 	}
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		return writer.GetParquetVersion() == ParquetVersion::V1 ? Encoding::PLAIN : Encoding::DELTA_LENGTH_BYTE_ARRAY;
+	}
+
+	duckdb_parquet::format::Encoding::type GetPageEncoding(BasicColumnWriterState &state,
+	                                                       ColumnWriterPageState *page_state) override {
+		return page_state->Cast<StringWriterPageState>().encoding;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1707,6 +2071,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1796,11 +2161,18 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
-void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void StructColumnWriter::FinishWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
 		// we add the null count of the struct to the null count of the children
 		state.child_states[child_idx]->null_count += state_p.null_count;
+		child_writers[child_idx]->FinishWrite(*state.child_states[child_idx]);
+	}
+}
+
+void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
 		child_writers[child_idx]->FinalizeWrite(*state.child_states[child_idx]);
 	}
 }
@@ -1828,6 +2200,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1970,6 +2343,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::FinishWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->FinishWrite(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
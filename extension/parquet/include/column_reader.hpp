@@ -54,6 +54,12 @@ public:
 
 	virtual void Skip(idx_t num_values);
 
+	//! Allows the reader to emit dictionary vectors for dictionary-encoded pages
+	//! Only set for readers of columns that are not nested in another column
+	void AllowDictionaryVectors() {
+		allow_dictionary_vectors = true;
+	}
+
 	ParquetReader &Reader();
 	const LogicalType &Type() const;
 	const SchemaElement &Schema() const;
@@ -126,8 +132,10 @@ protected:
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
+	//! Emits the dictionary offsets of a page as a dictionary vector, returns false if the reader cannot do so
+	virtual bool EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result);
 
-	virtual void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer);
+	virtual void PrepareDeltaLengthByteArray(shared_ptr<ResizeableBuffer> &buffer);
 	virtual void PrepareDeltaByteArray(ResizeableBuffer &buffer);
 	virtual void DeltaByteArray(uint8_t *defines, idx_t num_values, parquet_filter_t &filter, idx_t result_offset,
 	                            Vector &result);
@@ -156,6 +164,7 @@ protected:
 	idx_t byte_array_count = 0;
 
 	idx_t pending_skips = 0;
+	bool allow_dictionary_vectors = false;
 
 	virtual void ResetPage();
 
@@ -163,6 +172,9 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	void PreparePageHeader(PageHeader &page_hdr);
+	//! Skips over the next pages if all of their rows are skipped, returns the number of skipped rows
+	idx_t SkipPages(idx_t num_values);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of a page into the statistics of the column chunk
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -105,6 +107,10 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Flushes and compresses the remaining pages of the column chunk - this does not write anything to the file yet,
+	//! so it can be called in parallel for the column chunks of a row group
+	virtual void FinishWrite(ColumnWriterState &state) = 0;
+	//! Writes the column chunk to the file
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
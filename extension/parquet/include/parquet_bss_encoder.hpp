@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the Byte Stream Split encoding
+class BssEncoder {
+public:
+	static constexpr const idx_t BUFFER_SIZE = 1024;
+
+public:
+	//! Writes the k-th byte of all values to the k-th stream, the streams are written one after the other
+	template <class T>
+	static void Encode(WriteStream &writer, const T *values, idx_t count) {
+		data_t buffer[BUFFER_SIZE];
+		auto bytes = const_data_ptr_cast(values);
+		for (idx_t byte_idx = 0; byte_idx < sizeof(T); byte_idx++) {
+			for (idx_t offset = 0; offset < count; offset += BUFFER_SIZE) {
+				const auto next = MinValue<idx_t>(BUFFER_SIZE, count - offset);
+				for (idx_t i = 0; i < next; i++) {
+					buffer[i] = bytes[(offset + i) * sizeof(T) + byte_idx];
+				}
+				writer.WriteData(buffer, next);
+			}
+		}
+	}
+};
+
+} // namespace duckdb
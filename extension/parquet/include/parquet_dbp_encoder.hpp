@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding
+class DbpEncoder {
+public:
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS_IN_A_BLOCK = 4;
+	static constexpr const idx_t NUMBER_OF_VALUES_IN_A_MINIBLOCK =
+	    BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS_IN_A_BLOCK;
+
+public:
+	//! Encodes the values of an INT32 (T = int32_t) or INT64 (T = int64_t) page
+	//! The deltas are computed with the wrap-around arithmetic of T, so they always fit in the bit width of T
+	template <class T>
+	static void Encode(WriteStream &writer, const T *values, idx_t count) {
+		using UT = typename MakeUnsigned<T>::type;
+
+		//<block size in values> <number of miniblocks in a block> <total value count> <first value>
+		VarintEncode(BLOCK_SIZE_IN_VALUES, writer);
+		VarintEncode(NUMBER_OF_MINIBLOCKS_IN_A_BLOCK, writer);
+		VarintEncode(count, writer);
+		VarintEncode(IntToZigzag<T>(count == 0 ? 0 : values[0]), writer);
+
+		UT deltas[BLOCK_SIZE_IN_VALUES];
+		data_t packed[NUMBER_OF_VALUES_IN_A_MINIBLOCK * sizeof(UT)];
+		for (idx_t block_start = 1; block_start < count; block_start += BLOCK_SIZE_IN_VALUES) {
+			const auto block_count = MinValue<idx_t>(BLOCK_SIZE_IN_VALUES, count - block_start);
+			auto min_delta = NumericLimits<T>::Maximum();
+			for (idx_t i = 0; i < block_count; i++) {
+				deltas[i] = UT(values[block_start + i]) - UT(values[block_start + i - 1]);
+				min_delta = MinValue<T>(min_delta, T(deltas[i]));
+			}
+			// the miniblocks that are (partially) past the last value are padded with zeroes
+			for (idx_t i = block_count; i < BLOCK_SIZE_IN_VALUES; i++) {
+				deltas[i] = UT(min_delta);
+			}
+
+			//<min delta> <list of bitwidths of miniblocks> <miniblocks>
+			VarintEncode(IntToZigzag<T>(min_delta), writer);
+			uint8_t bit_widths[NUMBER_OF_MINIBLOCKS_IN_A_BLOCK];
+			for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+				UT all_bits = 0;
+				for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+					auto &delta = deltas[miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK + i];
+					delta -= UT(min_delta);
+					all_bits |= delta;
+				}
+				uint8_t bit_width = 0;
+				while (all_bits != 0) {
+					all_bits >>= 1;
+					bit_width++;
+				}
+				bit_widths[miniblock_idx] = bit_width;
+			}
+			writer.WriteData(bit_widths, NUMBER_OF_MINIBLOCKS_IN_A_BLOCK);
+			for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+				if (miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK >= block_count) {
+					// miniblocks without any values are not written
+					break;
+				}
+				const auto bit_width = bit_widths[miniblock_idx];
+				if (bit_width == 0) {
+					continue;
+				}
+				BitpackingPrimitives::PackBuffer<UT, true>(
+				    packed, &deltas[miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK], NUMBER_OF_VALUES_IN_A_MINIBLOCK,
+				    bit_width);
+				writer.WriteData(packed, NUMBER_OF_VALUES_IN_A_MINIBLOCK * bit_width / 8);
+			}
+		}
+	}
+
+private:
+	template <class T>
+	static uint64_t IntToZigzag(T value) {
+		using UT = typename MakeUnsigned<T>::type;
+		return (UT(value) << 1) ^ (value < 0 ? UT(-1) : UT(0));
+	}
+
+	static void VarintEncode(uint64_t value, WriteStream &writer) {
+		do {
+			uint8_t byte = value & 127;
+			value >>= 7;
+			if (value != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (value != 0);
+	}
+};
+
+} // namespace duckdb
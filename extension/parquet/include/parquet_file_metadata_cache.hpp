@@ -45,4 +45,27 @@ public:
 		return ObjectType();
 	}
 };
+
+//! ParquetPersistentMetadataCache caches the footers of Parquet files in a local directory, so that they do not have
+//! to be fetched again after a restart. The entries are keyed by the path, the size and the last modified time of
+//! the file.
+class ParquetPersistentMetadataCache {
+public:
+	static constexpr const char *MAGIC_BYTES = "DPMC";
+	static constexpr const uint32_t VERSION = 1;
+
+public:
+	//! The cache directory, or an empty string if the persistent cache is disabled
+	static string GetDirectory(ClientContext &context);
+	//! Reads the metadata of a file from the cache, returns nullptr if there is no up-to-date entry for the file
+	static unique_ptr<duckdb_parquet::format::FileMetaData> TryRead(ClientContext &context, const string &directory,
+	                                                                 const string &path, idx_t file_size,
+	                                                                 time_t last_modified);
+	//! Adds the metadata of a file to the cache
+	static void Write(ClientContext &context, const string &directory, const string &path, idx_t file_size,
+	                  time_t last_modified, const duckdb_parquet::format::FileMetaData &metadata);
+
+private:
+	static string GetEntryPath(FileSystem &fs, const string &directory, const string &path);
+};
 } // namespace duckdb
@@ -46,6 +46,17 @@ class ParquetEncryptionConfig;
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
+	// Number of bytes to prefetch for a Bloom filter header if the length of the Bloom filter is unknown
+	static constexpr idx_t BLOOM_FILTER_HEADER_PREFETCH_SIZE = 64;
+};
+
+//! A range of rows within a row group
+struct ParquetRowRange {
+	ParquetRowRange(idx_t start, idx_t end) : start(start), end(end) {
+	}
+
+	idx_t start;
+	idx_t end;
 };
 
 struct ParquetReaderScanState {
@@ -64,6 +75,14 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+	//! Only emit the first row of every row group - set when no column is read from the file, and the result of the
+	//! query does not depend on how often each row occurs
+	bool single_row_per_group = false;
+
+	//! The (sorted, disjoint) row ranges of the current row group that the page indexes of the filter columns ruled out
+	vector<ParquetRowRange> pruned_ranges;
+	//! The first pruned range that does not end before the current position in the row group
+	idx_t pruned_range_idx = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -209,6 +228,15 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Returns true if the Bloom filter of a filter column (if any) proves that the current row group cannot match the
+	//! filter
+	bool BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+	                         const TableFilter &filter);
+	//! Uses the page index of a filter column (if any) to add the row ranges of pages that cannot match the filter to
+	//! the pruned ranges of the current row group
+	void PrunePages(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter);
+	//! Removes the rows of the pruned ranges from the filter mask of the next chunk of the current row group
+	void ApplyPrunedRanges(ParquetReaderScanState &state, parquet_filter_t &filter_mask, idx_t count);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -2,6 +2,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #endif
 #include "parquet_types.h"
@@ -13,14 +14,71 @@ using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
 class ColumnReader;
+class ParquetBloomFilter;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the statistics of a column chunk or page of a primitive column
+	static unique_ptr<BaseStatistics> TransformStatistics(const ColumnReader &reader,
+	                                                      const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether or not the filter contains an equality comparison that could be refuted by a Bloom filter
+	static bool BloomFilterSupported(const TableFilter &filter);
+	//! Returns true if the Bloom filter of a column chunk proves that none of its values can satisfy the filter
+	static bool BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+	                                const ParquetBloomFilter &bloom_filter);
+};
+
+//! The header of a Bloom filter (BloomFilterHeader in the Parquet format)
+//! The algorithm, hash and compression are unions of which the Parquet format only defines a single member
+struct ParquetBloomFilterHeader : public duckdb_apache::thrift::TBase {
+	//! The size of the bitset in bytes
+	int32_t num_bytes = 0;
+	//! Whether or not the filter uses the split block algorithm, the XXH64 hash and no compression
+	bool supported = true;
+
+	uint32_t read(duckdb_apache::thrift::protocol::TProtocol *iprot) override;
+	uint32_t write(duckdb_apache::thrift::protocol::TProtocol *oprot) const override;
+};
+
+//! ParquetBloomFilter is a split block Bloom filter as specified by the Parquet format: a bitset of 256-bit blocks
+//! of which a value sets (and checks) one bit in each of the eight 32-bit words of the block selected by its hash
+class ParquetBloomFilter {
+public:
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The maximum size of a Bloom filter we write (the Parquet format recommends 128MB)
+	static constexpr const idx_t MAX_BLOOM_FILTER_SIZE = 128 * 1024 * 1024;
+
+	//! Creates an empty Bloom filter of the given size in bytes (which must be a multiple of the block size)
+	ParquetBloomFilter(Allocator &allocator, idx_t num_bytes);
+
+public:
+	//! Returns the size in bytes of a Bloom filter for the given number of distinct values with the given false
+	//! positive ratio
+	static idx_t OptimalSize(idx_t num_distinct, double false_positive_ratio);
+	//! Hashes the plain encoding of a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	data_ptr_t GetData() {
+		return data.get();
+	}
+	idx_t GetSize() const {
+		return data.GetSize();
+	}
+
+private:
+	AllocatedData data;
+	idx_t block_count;
 };
 
 } // namespace duckdb
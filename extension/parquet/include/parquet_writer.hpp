@@ -10,6 +10,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
@@ -32,12 +33,29 @@ class ParquetEncryptionConfig;
 class Serializer;
 class Deserializer;
 
+//! The version of the format the Parquet writer targets
+enum class ParquetVersion : uint8_t {
+	//! Only write PLAIN and dictionary encoded pages, which all readers support
+	V1 = 1,
+	//! Also write DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY and BYTE_STREAM_SPLIT encoded pages
+	V2 = 2
+};
+
 struct PreparedRowGroup {
 	duckdb_parquet::format::RowGroup row_group;
 	vector<unique_ptr<ColumnWriterState>> states;
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index of a column chunk, which is written after all row groups
+struct ParquetPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The column index (if we have the statistics of all pages)
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -67,7 +85,9 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, optional_idx page_size_bytes,
+	              const vector<string> &bloom_filter_columns, double bloom_filter_false_positive_ratio,
+	              ParquetVersion parquet_version);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,6 +123,17 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	optional_idx PageSizeBytes() const {
+		return page_size_bytes;
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
+	//! Whether or not to write Bloom filters for the (leaf) column with the given path
+	bool HasBloomFilter(const vector<string> &schema_path) const;
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -113,10 +144,15 @@ public:
 
 	GeoParquetFileMetadata &GetGeoParquetData();
 
+	//! Adds the page index of a column chunk of the row group that is currently being flushed
+	void AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                  duckdb_parquet::format::OffsetIndex offset_index);
+
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
 
 private:
+	ClientContext &context;
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
@@ -126,6 +162,10 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	optional_idx page_size_bytes;
+	case_insensitive_set_t bloom_filter_columns;
+	double bloom_filter_false_positive_ratio;
+	ParquetVersion parquet_version;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -136,6 +176,8 @@ private:
 	vector<unique_ptr<ColumnWriter>> column_writers;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
+
+	vector<ParquetPageIndex> page_indexes;
 };
 
 } // namespace duckdb
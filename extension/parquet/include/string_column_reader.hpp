@@ -31,14 +31,17 @@ public:
 	StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t schema_idx_p,
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
-	unsafe_unique_ptr<string_t[]> dict_strings;
+	//! The strings of the dictionary, followed by a NULL entry for the rows that are NULL
+	unique_ptr<Vector> dict_vector;
+	string_t *dict_strings = nullptr;
+	idx_t dict_entry_count = 0;
 	idx_t fixed_width_string_length;
 	idx_t delta_offset = 0;
 
 public:
 	void Dictionary(shared_ptr<ResizeableBuffer> dictionary_data, idx_t num_entries) override;
 
-	void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer) override;
+	void PrepareDeltaLengthByteArray(shared_ptr<ResizeableBuffer> &buffer) override;
 	void PrepareDeltaByteArray(ResizeableBuffer &buffer) override;
 	void DeltaByteArray(uint8_t *defines, idx_t num_values, parquet_filter_t &filter, idx_t result_offset,
 	                    Vector &result) override;
@@ -48,6 +51,7 @@ public:
 protected:
 	void DictReference(Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
+	bool EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) override;
 };
 
 } // namespace duckdb
@@ -1,5 +1,8 @@
 #pragma once
 #include <list>
+#ifndef DUCKDB_NO_THREADS
+#include <thread>
+#endif
 #include "thrift/protocol/TCompactProtocol.h"
 #include "thrift/transport/TBufferTransports.h"
 
@@ -7,6 +10,9 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
 #endif
 
 namespace duckdb {
@@ -31,16 +37,22 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
-	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+	static constexpr uint64_t DEFAULT_ALLOW_GAP = 1 << 14; // 16 KiB
+
+	explicit ReadHeadComparator(uint64_t allow_gap = DEFAULT_ALLOW_GAP) : allow_gap(allow_gap) {
+	}
+
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
@@ -51,6 +63,8 @@ struct ReadHeadComparator {
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
 struct ReadAheadBuffer {
+	static constexpr idx_t DEFAULT_MAX_CONCURRENT_READS = 8;
+
 	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
 	}
 
@@ -63,6 +77,14 @@ struct ReadAheadBuffer {
 	FileHandle &handle;
 
 	idx_t total_size = 0;
+	// The maximum number of ranges that are read concurrently, the handle must support parallel reads if this is > 1
+	idx_t max_concurrent_reads = 1;
+
+	// Sets the gap below which registered ranges are merged into a single read
+	void SetMergeGap(uint64_t allow_gap) {
+		D_ASSERT(merge_set.empty());
+		merge_set = std::set<ReadHead *, ReadHeadComparator>(ReadHeadComparator(allow_gap));
+	}
 
 	// Add a read head to the prefetching list
 	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true) {
@@ -103,17 +125,64 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Prefetch all read heads that have not been read yet
 	void Prefetch() {
+		vector<ReadHead *> to_read;
 		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
-
+			if (read_head.data_isset) {
+				continue;
+			}
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
+			read_head.Allocate(allocator);
+			to_read.push_back(&read_head);
+		}
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+#ifndef DUCKDB_NO_THREADS
+		if (max_concurrent_reads > 1 && to_read.size() > 1) {
+			// issue the reads concurrently: for remote files the latency of a request dominates its transfer time
+			atomic<idx_t> next_read(0);
+			mutex error_lock;
+			ErrorData error;
+			auto read_ranges = [&]() {
+				for (auto read_idx = next_read++; read_idx < to_read.size(); read_idx = next_read++) {
+					auto &read_head = *to_read[read_idx];
+					try {
+						handle.Read(read_head.data.get(), read_head.size, read_head.location);
+					} catch (std::exception &ex) {
+						lock_guard<mutex> guard(error_lock);
+						if (!error.HasError()) {
+							error = ErrorData(ex);
+						}
+						// stop issuing new reads
+						next_read = to_read.size();
+						return;
+					}
+				}
+			};
+			vector<std::thread> threads;
+			auto thread_count = MinValue<idx_t>(max_concurrent_reads, to_read.size());
+			threads.reserve(thread_count - 1);
+			for (idx_t i = 1; i < thread_count; i++) {
+				threads.emplace_back(read_ranges);
+			}
+			read_ranges();
+			for (auto &thread : threads) {
+				thread.join();
+			}
+			if (error.HasError()) {
+				error.Throw();
+			}
+			for (auto read_head : to_read) {
+				read_head->data_isset = true;
+			}
+			return;
+		}
+#endif
+		for (auto read_head : to_read) {
+			handle.Read(read_head->data.get(), read_head->size, read_head->location);
+			read_head->data_isset = true;
 		}
 	}
 };
@@ -169,6 +238,12 @@ public:
 		ra_buffer.merge_set.clear();
 	}
 
+	// Configures how registered ranges are merged and read
+	void SetPrefetchConfig(uint64_t merge_gap, idx_t max_concurrent_reads) {
+		ra_buffer.SetMergeGap(merge_gap);
+		ra_buffer.max_concurrent_reads = max_concurrent_reads;
+	}
+
 	// Prefetch all previously registered ranges
 	void PrefetchRegistered() {
 		ra_buffer.Prefetch();
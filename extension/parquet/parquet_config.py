@@ -26,6 +26,7 @@ source_files = [
         'extension/parquet/column_writer.cpp',
         'extension/parquet/parquet_crypto.cpp',
         'extension/parquet/parquet_extension.cpp',
+        'extension/parquet/parquet_file_metadata_cache.cpp',
         'extension/parquet/parquet_metadata.cpp',
         'extension/parquet/parquet_reader.cpp',
         'extension/parquet/parquet_statistics.cpp',
@@ -44,6 +44,8 @@
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
@@ -73,6 +75,9 @@ struct ParquetReadBindData : public TableFunctionData {
 	ParquetOptions parquet_options;
 
 	MultiFileReaderBindData reader_bind;
+	//! Whether the scan only has to emit a single row for every row group, set by the optimizer when only hive
+	//! partition columns (or the filename) are read and the query does not depend on how often each row occurs
+	bool single_row_per_row_group = false;
 
 	void Initialize(shared_ptr<ParquetReader> reader) {
 		initial_reader = std::move(reader);
@@ -201,6 +206,14 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+	//! The (estimated) maximum uncompressed size of a data page
+	optional_idx page_size_bytes;
+	//! The columns for which to write Bloom filters
+	vector<string> bloom_filter_columns;
+	//! The false positive ratio the Bloom filters are sized for
+	double bloom_filter_false_positive_ratio = 0.01;
+	//! Which encodings the writer may use
+	ParquetVersion parquet_version = ParquetVersion::V1;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -899,6 +912,8 @@ public:
 					scan_data.reader = current_reader_data.reader;
 					vector<idx_t> group_indexes {parallel_state.row_group_index};
 					scan_data.reader->InitializeScan(context, scan_data.scan_state, group_indexes);
+					scan_data.scan_state.single_row_per_group =
+					    bind_data.single_row_per_row_group && scan_data.reader->reader_data.column_ids.empty();
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
 					parallel_state.row_group_index++;
@@ -1273,6 +1288,57 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "page_size_bytes") {
+			auto roption = option.second[0];
+			idx_t page_size_bytes;
+			if (roption.GetTypeMutable().id() == LogicalTypeId::VARCHAR) {
+				page_size_bytes = DBConfig::ParseMemoryLimit(roption.ToString());
+			} else {
+				page_size_bytes = roption.GetValue<uint64_t>();
+			}
+			if (page_size_bytes == 0) {
+				throw BinderException("PAGE_SIZE_BYTES must be greater than 0");
+			}
+			bind_data->page_size_bytes = page_size_bytes;
+		} else if (loption == "bloom_filter_columns") {
+			auto &roption = option.second[0];
+			vector<Value> column_values;
+			if (roption.type().id() == LogicalTypeId::LIST) {
+				column_values = ListValue::GetChildren(roption);
+			} else {
+				column_values.push_back(roption);
+			}
+			for (auto &column_value : column_values) {
+				if (column_value.IsNull()) {
+					throw BinderException("BLOOM_FILTER_COLUMNS cannot contain NULL values");
+				}
+				auto column_name = column_value.ToString();
+				// nested columns are specified by their dot-separated path, of which the first part is the column name
+				auto top_level_name = StringUtil::Split(column_name, '.')[0];
+				bool found = false;
+				for (auto &name : names) {
+					found = found || StringUtil::CIEquals(name, top_level_name);
+				}
+				if (!found) {
+					throw BinderException("Column \"%s\" specified in BLOOM_FILTER_COLUMNS not found", column_name);
+				}
+				bind_data->bloom_filter_columns.push_back(std::move(column_name));
+			}
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("BLOOM_FILTER_FALSE_POSITIVE_RATIO must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
+		} else if (loption == "parquet_version") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected parquet_version 'V1' or 'V2'");
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -1302,7 +1368,9 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.page_size_bytes, parquet_bind.bloom_filter_columns,
+	                             parquet_bind.bloom_filter_false_positive_ratio, parquet_bind.parquet_version);
 	return std::move(global_state);
 }
 
@@ -1426,6 +1494,13 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<optional_idx>(112, "page_size_bytes", bind_data.page_size_bytes);
+	serializer.WritePropertyWithDefault<vector<string>>(113, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<double>(114, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
+	serializer.WritePropertyWithDefault<uint8_t>(115, "parquet_version",
+	                                             static_cast<uint8_t>(bind_data.parquet_version),
+	                                             static_cast<uint8_t>(ParquetVersion::V1));
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1445,6 +1520,12 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithExplicitDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithExplicitDefault<bool>(111, "debug_use_openssl", true);
+	deserializer.ReadPropertyWithDefault<optional_idx>(112, "page_size_bytes", data->page_size_bytes);
+	deserializer.ReadPropertyWithDefault<vector<string>>(113, "bloom_filter_columns", data->bloom_filter_columns);
+	deserializer.ReadPropertyWithExplicitDefault<double>(114, "bloom_filter_false_positive_ratio",
+	                                                     data->bloom_filter_false_positive_ratio, 0.01);
+	data->parquet_version = static_cast<ParquetVersion>(deserializer.ReadPropertyWithExplicitDefault<uint8_t>(
+	    115, "parquet_version", static_cast<uint8_t>(ParquetVersion::V1)));
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1619,6 +1700,87 @@ static vector<unique_ptr<Expression>> ParquetWriteSelect(CopyToSelectInput &inpu
 	return {};
 }
 
+//===--------------------------------------------------------------------===//
+// Hive partition optimizer
+//===--------------------------------------------------------------------===//
+static bool IsDuplicateInsensitive(const Expression &expr) {
+	auto &aggr = expr.Cast<BoundAggregateExpression>();
+	if (aggr.IsDistinct()) {
+		return true;
+	}
+	auto &name = aggr.function.name;
+	return name == "min" || name == "max" || name == "any_value" || name == "arbitrary" || name == "first" ||
+	       name == "bool_and" || name == "bool_or";
+}
+
+//! Returns the Parquet scan below the projections and filters of "op" if it only reads hive partition columns
+static optional_ptr<LogicalGet> GetPartitionOnlyParquetScan(LogicalOperator &op) {
+	reference<LogicalOperator> child(op);
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		if (child.get().type != LogicalOperatorType::LOGICAL_PROJECTION &&
+		    child.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			return nullptr;
+		}
+		for (auto &expr : child.get().expressions) {
+			if (expr->IsVolatile()) {
+				return nullptr;
+			}
+		}
+		child = *child.get().children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.function != ParquetScanFunction::ParquetScanImplementation || !get.bind_data) {
+		return nullptr;
+	}
+	auto &bind_data = get.bind_data->Cast<ParquetReadBindData>();
+	for (auto &column_id : get.GetColumnIds()) {
+		if (column_id == bind_data.reader_bind.filename_idx) {
+			continue;
+		}
+		bool is_partition_column = false;
+		for (auto &partition : bind_data.reader_bind.hive_partitioning_indexes) {
+			if (partition.index == column_id) {
+				is_partition_column = true;
+				break;
+			}
+		}
+		if (!is_partition_column) {
+			return nullptr;
+		}
+	}
+	return &get;
+}
+
+//! DISTINCT and GROUP BY queries with only duplicate-insensitive aggregates over Parquet scans that read nothing but
+//! hive partition columns only need a single row of every row group: the other rows are all the same
+static void OptimizePartitionOnlyScans(LogicalOperator &op) {
+	bool duplicate_insensitive = false;
+	if (op.type == LogicalOperatorType::LOGICAL_DISTINCT) {
+		duplicate_insensitive = true;
+	} else if (op.type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		duplicate_insensitive = true;
+		for (auto &expr : op.expressions) {
+			if (!IsDuplicateInsensitive(*expr)) {
+				duplicate_insensitive = false;
+				break;
+			}
+		}
+	}
+	if (duplicate_insensitive) {
+		auto get = GetPartitionOnlyParquetScan(*op.children[0]);
+		if (get) {
+			get->bind_data->Cast<ParquetReadBindData>().single_row_per_row_group = true;
+		}
+	}
+	for (auto &child : op.children) {
+		OptimizePartitionOnlyScans(*child);
+	}
+}
+
+static void ParquetOptimizeFunction(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	OptimizePartitionOnlyScans(*plan);
+}
+
 void ParquetExtension::Load(DuckDB &db) {
 	auto &db_instance = *db.instance;
 	auto &fs = db.GetFileSystem();
@@ -1675,8 +1837,23 @@ void ParquetExtension::Load(DuckDB &db) {
 
 	auto &config = DBConfig::GetConfig(*db.instance);
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
+	OptimizerExtension optimizer;
+	optimizer.optimize_function = ParquetOptimizeFunction;
+	config.optimizer_extensions.push_back(std::move(optimizer));
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("parquet_metadata_cache_directory",
+	                          "Directory in which the metadata of Parquet files is cached across restarts. Empty to "
+	                          "disable the persistent metadata cache.",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("parquet_prefetch_concurrent_reads",
+	                          "Maximum number of byte ranges of a remote Parquet file that are read concurrently when "
+	                          "prefetching a row group.",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadAheadBuffer::DEFAULT_MAX_CONCURRENT_READS));
+	config.AddExtensionOption("parquet_prefetch_merge_gap",
+	                          "Byte ranges of a remote Parquet file that are at most this many bytes apart are "
+	                          "fetched with a single request when prefetching a row group.",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadHeadComparator::DEFAULT_ALLOW_GAP));
 }
 
 std::string ParquetExtension::Name() {
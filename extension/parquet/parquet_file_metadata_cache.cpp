@@ -0,0 +1,117 @@
+#include "parquet_file_metadata_cache.hpp"
+
+#include "thrift_tools.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/client_context.hpp"
+#endif
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TCompactProtocolT;
+using duckdb_apache::thrift::transport::TMemoryBuffer;
+using duckdb_parquet::format::FileMetaData;
+
+string ParquetPersistentMetadataCache::GetDirectory(ClientContext &context) {
+	Value directory;
+	if (!context.TryGetCurrentSetting("parquet_metadata_cache_directory", directory) || directory.IsNull()) {
+		return string();
+	}
+	return directory.ToString();
+}
+
+string ParquetPersistentMetadataCache::GetEntryPath(FileSystem &fs, const string &directory, const string &path) {
+	// the entries are named after the hash of the path - the path itself is stored in the entry to detect collisions
+	auto hash = Hash(path.c_str(), path.size());
+	return fs.JoinPath(directory, StringUtil::Format("%016llx.footer", static_cast<uint64_t>(hash)));
+}
+
+unique_ptr<FileMetaData> ParquetPersistentMetadataCache::TryRead(ClientContext &context, const string &directory,
+                                                                 const string &path, idx_t file_size,
+                                                                 time_t last_modified) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	try {
+		auto handle = fs.OpenFile(GetEntryPath(fs, directory, path),
+		                          FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle) {
+			return nullptr;
+		}
+		auto entry_size = NumericCast<idx_t>(handle->GetFileSize());
+		auto buffer = make_unsafe_uniq_array<data_t>(entry_size);
+		handle->Read(buffer.get(), entry_size, 0);
+
+		//<magic bytes> <version> <file size> <last modified> <path> <footer>
+		MemoryStream stream(buffer.get(), entry_size);
+		char magic_bytes[4];
+		stream.ReadData(data_ptr_cast(magic_bytes), sizeof(magic_bytes));
+		if (memcmp(magic_bytes, MAGIC_BYTES, sizeof(magic_bytes)) != 0 || stream.Read<uint32_t>() != VERSION) {
+			return nullptr;
+		}
+		if (stream.Read<uint64_t>() != file_size || stream.Read<int64_t>() != static_cast<int64_t>(last_modified)) {
+			// the file has changed since we cached its metadata
+			return nullptr;
+		}
+		auto path_length = stream.Read<uint32_t>();
+		string entry_path(path_length, '\0');
+		stream.ReadData(data_ptr_cast(&entry_path[0]), path_length);
+		if (entry_path != path) {
+			return nullptr;
+		}
+		auto footer_length = stream.Read<uint32_t>();
+		if (stream.GetPosition() + footer_length != entry_size) {
+			return nullptr;
+		}
+
+		auto transport = std::make_shared<TMemoryBuffer>(buffer.get() + stream.GetPosition(), footer_length);
+		TCompactProtocolT<TMemoryBuffer> protocol(std::move(transport));
+		auto metadata = make_uniq<FileMetaData>();
+		metadata->read(&protocol);
+		return metadata;
+	} catch (std::exception &) {
+		// the cache is best-effort: a corrupt or unreadable entry is ignored, and overwritten later
+		return nullptr;
+	}
+}
+
+void ParquetPersistentMetadataCache::Write(ClientContext &context, const string &directory, const string &path,
+                                           idx_t file_size, time_t last_modified, const FileMetaData &metadata) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	try {
+		auto transport = std::make_shared<TMemoryBuffer>();
+		TCompactProtocolT<TMemoryBuffer> protocol(transport);
+		metadata.write(&protocol);
+		uint8_t *footer;
+		uint32_t footer_length;
+		transport->getBuffer(&footer, &footer_length);
+
+		MemoryStream stream;
+		stream.WriteData(const_data_ptr_cast(MAGIC_BYTES), 4);
+		stream.Write<uint32_t>(VERSION);
+		stream.Write<uint64_t>(file_size);
+		stream.Write<int64_t>(static_cast<int64_t>(last_modified));
+		stream.Write<uint32_t>(NumericCast<uint32_t>(path.size()));
+		stream.WriteData(const_data_ptr_cast(path.c_str()), path.size());
+		stream.Write<uint32_t>(footer_length);
+		stream.WriteData(footer, footer_length);
+
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+		// write to a temporary file first, so concurrent readers never see a partially written entry
+		auto entry_path = GetEntryPath(fs, directory, path);
+		auto temp_path = entry_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+		{
+			auto handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			handle->Write(stream.GetData(), stream.GetPosition());
+		}
+		fs.MoveFile(temp_path, entry_path);
+	} catch (std::exception &) {
+		// failing to cache the metadata is not an error
+	}
+}
+
+} // namespace duckdb
@@ -28,6 +28,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -41,10 +42,12 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
@@ -62,6 +65,22 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
              const EncryptionUtil &encryption_util) {
 	auto current_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 
+	// we never store the (decrypted) metadata of encrypted files on disk
+	auto cache_directory = encryption_config ? string() : ParquetPersistentMetadataCache::GetDirectory(context);
+	idx_t cache_file_size = 0;
+	time_t cache_last_modified = 0;
+	if (!cache_directory.empty()) {
+		cache_file_size = file_handle.GetFileSize();
+		cache_last_modified = FileSystem::GetFileSystem(context).GetLastModifiedTime(file_handle);
+		auto metadata = ParquetPersistentMetadataCache::TryRead(context, cache_directory, file_handle.path,
+		                                                        cache_file_size, cache_last_modified);
+		if (metadata) {
+			auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
+			return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time,
+			                                                 std::move(geo_metadata));
+		}
+	}
+
 	auto file_proto = CreateThriftFileProtocol(allocator, file_handle, false);
 	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
 	auto file_size = transport.GetSize();
@@ -116,6 +135,11 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
 		metadata->read(file_proto.get());
 	}
 
+	if (!cache_directory.empty()) {
+		ParquetPersistentMetadataCache::Write(context, cache_directory, file_handle.path, cache_file_size,
+		                                      cache_last_modified, *metadata);
+	}
+
 	// Try to read the GeoParquet metadata (if present)
 	auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
 
@@ -440,6 +464,9 @@ unique_ptr<ColumnReader> ParquetReader::CreateReader(ClientContext &context) {
 	D_ASSERT(file_meta_data->row_groups.empty() || next_file_idx == file_meta_data->row_groups[0].columns.size());
 
 	auto &root_struct_reader = ret->Cast<StructColumnReader>();
+	for (auto &child_reader : root_struct_reader.child_readers) {
+		child_reader->AllowDictionaryVectors();
+	}
 	// add casts if required
 	for (auto &entry : reader_data.cast_map) {
 		auto column_idx = entry.first;
@@ -717,6 +744,31 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+static FilterPropagateResult CheckParquetFilter(const ColumnReader &column_reader, BaseStatistics &stats,
+                                                const Statistics &pq_col_stats, TableFilter &filter) {
+	if (column_reader.Type().id() != LogicalTypeId::VARCHAR || !pq_col_stats.__isset.min_value ||
+	    !pq_col_stats.__isset.max_value) {
+		return filter.CheckStatistics(stats);
+	}
+	// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+	// however, when reading remote Parquet files, skipping row groups is really important
+	// here, we implement a special case to check the full length for string filters
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : and_filter.child_filters) {
+			auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+			if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			} else if (child_prune_result != and_result) {
+				and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return and_result;
+	}
+	return CheckParquetStringFilter(stats, pq_col_stats, filter);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -729,46 +781,30 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
 		if (stats && filter_entry != reader_data.filters->filters.end()) {
-			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
+			// only leaf columns have a column chunk (with string statistics, a Bloom filter and page indexes)
+			const bool is_leaf = !column_reader->Type().IsNested();
+			auto prune_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			if (is_leaf) {
+				prune_result = CheckParquetFilter(*column_reader, *stats,
+				                                  group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
 			} else {
 				prune_result = filter.CheckStatistics(*stats);
 			}
-
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE && is_leaf &&
+			    BloomFilterExcludes(state, *column_reader, filter)) {
+				// the statistics cannot rule out an equality filter - but the Bloom filter can
+				prune_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
 			}
-			if (skip_chunk) {
+			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
 				return;
 			}
+			if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE && is_leaf) {
+				// we cannot skip the entire row group - but we might be able to skip some of its pages
+				PrunePages(state, *column_reader, filter);
+			}
 		}
 	}
 
@@ -776,6 +812,120 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	auto &meta_data = GetGroup(state).columns[column_reader.FileIdx()].meta_data;
+	if (!meta_data.__isset.bloom_filter_offset || meta_data.bloom_filter_offset <= 0 ||
+	    parquet_options.encryption_config || !ParquetStatisticsUtils::BloomFilterSupported(filter) ||
+	    column_reader.Type() != DeriveLogicalType(column_reader.Schema())) {
+		// we can only hash the filter constants if we read the column as it is stored (i.e. without any casts)
+		return false;
+	}
+
+	// like the page indexes, the Bloom filter is stored outside of the column chunk
+	auto file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, false);
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
+	auto file_size = transport.GetSize();
+	auto bloom_filter_offset = NumericCast<idx_t>(meta_data.bloom_filter_offset);
+	if (bloom_filter_offset >= file_size) {
+		return false;
+	}
+	// if the length is not known we only prefetch the header, and read the bitset directly into the filter
+	idx_t prefetch_size = ParquetReaderPrefetchConfig::BLOOM_FILTER_HEADER_PREFETCH_SIZE;
+	if (meta_data.__isset.bloom_filter_length && meta_data.bloom_filter_length > 0) {
+		prefetch_size = NumericCast<idx_t>(meta_data.bloom_filter_length);
+	}
+	transport.SetLocation(bloom_filter_offset);
+	transport.Prefetch(bloom_filter_offset, MinValue<idx_t>(prefetch_size, file_size - bloom_filter_offset));
+	ParquetBloomFilterHeader header;
+	header.read(file_proto.get());
+	if (!header.supported || header.num_bytes <= 0 ||
+	    NumericCast<idx_t>(header.num_bytes) % ParquetBloomFilter::BLOCK_SIZE != 0 ||
+	    transport.GetLocation() + NumericCast<idx_t>(header.num_bytes) > file_size) {
+		return false;
+	}
+	ParquetBloomFilter bloom_filter(allocator, NumericCast<idx_t>(header.num_bytes));
+	transport.read(bloom_filter.GetData(), NumericCast<uint32_t>(bloom_filter.GetSize()));
+	return ParquetStatisticsUtils::BloomFilterExcludes(column_reader, filter, bloom_filter);
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter) {
+	auto &group = GetGroup(state);
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	if (column_reader.MaxRepeat() > 0 || parquet_options.encryption_config ||
+	    !column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+		// pages of repeated columns do not contain whole rows, and we do not support encrypted page indexes
+		return;
+	}
+
+	// the page indexes are stored outside of the column chunk, read them through their own transport
+	auto file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, false);
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
+	ColumnIndex column_index;
+	transport.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+	transport.Prefetch(NumericCast<idx_t>(column_chunk.column_index_offset),
+	                   NumericCast<idx_t>(column_chunk.column_index_length));
+	column_index.read(file_proto.get());
+	OffsetIndex offset_index;
+	transport.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+	transport.Prefetch(NumericCast<idx_t>(column_chunk.offset_index_offset),
+	                   NumericCast<idx_t>(column_chunk.offset_index_length));
+	offset_index.read(file_proto.get());
+
+	auto &page_locations = offset_index.page_locations;
+	auto page_count = page_locations.size();
+	if (page_count < 2 || column_index.null_pages.size() != page_count ||
+	    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count) {
+		// nothing to prune within the row group, or a malformed page index
+		return;
+	}
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		unique_ptr<BaseStatistics> page_stats;
+		Statistics parquet_stats;
+		if (column_index.null_pages[page_idx]) {
+			// the page only contains NULL values
+			page_stats = BaseStatistics::CreateEmpty(column_reader.Type()).ToUnique();
+			page_stats->Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
+		} else {
+			parquet_stats.__set_min_value(column_index.min_values[page_idx]);
+			parquet_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (column_index.__isset.null_counts && column_index.null_counts.size() == page_count) {
+				parquet_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			page_stats = ParquetStatisticsUtils::TransformStatistics(column_reader, parquet_stats);
+		}
+		if (!page_stats ||
+		    CheckParquetFilter(column_reader, *page_stats, parquet_stats, filter) !=
+		        FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			continue;
+		}
+		auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto page_end = page_idx + 1 < page_count ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                                          : NumericCast<idx_t>(group.num_rows);
+		if (page_start < page_end) {
+			state.pruned_ranges.emplace_back(page_start, page_end);
+		}
+	}
+}
+
+void ParquetReader::ApplyPrunedRanges(ParquetReaderScanState &state, parquet_filter_t &filter_mask, idx_t count) {
+	auto &pruned_ranges = state.pruned_ranges;
+	auto chunk_start = state.group_offset;
+	auto chunk_end = state.group_offset + count;
+	while (state.pruned_range_idx < pruned_ranges.size() && pruned_ranges[state.pruned_range_idx].end <= chunk_start) {
+		state.pruned_range_idx++;
+	}
+	for (idx_t range_idx = state.pruned_range_idx;
+	     range_idx < pruned_ranges.size() && pruned_ranges[range_idx].start < chunk_end; range_idx++) {
+		auto &range = pruned_ranges[range_idx];
+		auto start = MaxValue<idx_t>(range.start, chunk_start) - chunk_start;
+		auto end = MinValue<idx_t>(range.end, chunk_end) - chunk_start;
+		for (idx_t i = start; i < end; i++) {
+			filter_mask.reset(i);
+		}
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -796,7 +946,8 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 
 		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
 			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			// the prefetched ranges of a row group are read concurrently
+			flags |= FileFlags::FILE_FLAGS_DIRECT_IO | FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
 		} else {
 			state.prefetch_mode = false;
 		}
@@ -805,6 +956,19 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 	}
 
 	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	if (state.prefetch_mode) {
+		uint64_t merge_gap = ReadHeadComparator::DEFAULT_ALLOW_GAP;
+		idx_t max_concurrent_reads = ReadAheadBuffer::DEFAULT_MAX_CONCURRENT_READS;
+		Value setting;
+		if (context.TryGetCurrentSetting("parquet_prefetch_merge_gap", setting) && !setting.IsNull()) {
+			merge_gap = setting.GetValue<uint64_t>();
+		}
+		if (context.TryGetCurrentSetting("parquet_prefetch_concurrent_reads", setting) && !setting.IsNull()) {
+			max_concurrent_reads = MaxValue<idx_t>(setting.GetValue<uint64_t>(), 1);
+		}
+		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+		trans.SetPrefetchConfig(merge_gap, max_concurrent_reads);
+	}
 	state.root_reader = CreateReader(context);
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -940,7 +1104,34 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count);
+
+static void ApplyDictionaryFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count,
+                                  idx_t dictionary_size) {
+	// evaluate the filter once for every entry of the dictionary
+	parquet_filter_t dictionary_mask;
+	for (idx_t i = 0; i < dictionary_size; i++) {
+		dictionary_mask.set(i);
+	}
+	ApplyFilter(DictionaryVector::Child(v), filter, dictionary_mask, dictionary_size);
+
+	auto &sel = DictionaryVector::SelVector(v);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			filter_mask.set(i, dictionary_mask.test(sel.get_index(i)));
+		}
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (v.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto dictionary_size = DictionaryVector::DictionarySize(v);
+		if (dictionary_size.IsValid() && dictionary_size.GetIndex() < count) {
+			ApplyDictionaryFilter(v, filter, filter_mask, count, dictionary_size.GetIndex());
+			return;
+		}
+		v.Flatten(count);
+	}
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
@@ -994,6 +1185,18 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			break;
+		}
+		auto &filter_data = *dynamic_filter.filter_data;
+		lock_guard<mutex> l(filter_data.lock);
+		if (filter_data.initialized) {
+			ApplyFilter(v, *filter_data.filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -1028,6 +1231,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			return false;
 		}
 
+		state.pruned_ranges.clear();
+		state.pruned_range_idx = 0;
 		uint64_t to_scan_compressed_bytes = 0;
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
 			PrepareRowGroupBuffer(state, col_idx);
@@ -1038,6 +1243,23 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
 
+		if (state.pruned_ranges.size() > 1) {
+			// the pruned ranges of the different filter columns can overlap - merge them
+			std::sort(state.pruned_ranges.begin(), state.pruned_ranges.end(),
+			          [](const ParquetRowRange &a, const ParquetRowRange &b) { return a.start < b.start; });
+			idx_t merged_count = 0;
+			for (auto &range : state.pruned_ranges) {
+				if (merged_count > 0 && range.start <= state.pruned_ranges[merged_count - 1].end) {
+					auto &last = state.pruned_ranges[merged_count - 1];
+					last.end = MaxValue<idx_t>(last.end, range.end);
+				} else {
+					state.pruned_ranges[merged_count++] = range;
+				}
+			}
+			state.pruned_ranges.erase(state.pruned_ranges.begin() + NumericCast<int64_t>(merged_count),
+			                          state.pruned_ranges.end());
+		}
+
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
@@ -1089,6 +1311,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	}
 
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	if (state.single_row_per_group) {
+		this_output_chunk_rows = MinValue<idx_t>(this_output_chunk_rows, 1);
+	}
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1105,6 +1330,10 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	for (idx_t i = this_output_chunk_rows; i < STANDARD_VECTOR_SIZE; i++) {
 		filter_mask.set(i, false);
 	}
+	if (!state.pruned_ranges.empty()) {
+		// rows in pages that the page index ruled out are never relevant either
+		ApplyPrunedRanges(state, filter_mask, this_output_chunk_rows);
+	}
 
 	state.define_buf.zero();
 	state.repeat_buf.zero();
@@ -1179,7 +1408,12 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 	}
 
-	state.group_offset += this_output_chunk_rows;
+	if (state.single_row_per_group) {
+		// the remaining rows of the row group are the same as the one we emitted
+		state.group_offset = GetGroup(state).num_rows;
+	} else {
+		state.group_offset += this_output_chunk_rows;
+	}
 	return true;
 }
 
@@ -5,16 +5,20 @@
 #include "parquet_timestamp.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "zstd/common/xxhash.h"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
 
 namespace duckdb {
 
 using duckdb_parquet::format::ConvertedType;
+using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static unique_ptr<BaseStatistics> CreateNumericStats(const LogicalType &type,
@@ -320,8 +324,12 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
 
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                                                       const Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
@@ -387,4 +395,315 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+bool ParquetStatisticsUtils::BloomFilterSupported(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterSupported(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterSupported(*child_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static uint64_t BloomFilterHashPlain(T value) {
+	return ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(T));
+}
+
+static bool TryGetUnscaledDecimal(const Value &value, int64_t &result) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT16:
+		result = value.GetValueUnsafe<int16_t>();
+		return true;
+	case PhysicalType::INT32:
+		result = value.GetValueUnsafe<int32_t>();
+		return true;
+	case PhysicalType::INT64:
+		result = value.GetValueUnsafe<int64_t>();
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Computes the hash of the plain encoding of a value as the writer of the file would have written it
+static bool TryBloomFilterHash(const ColumnReader &reader, const Value &value, uint64_t &result) {
+	auto &type = reader.Type();
+	if (value.IsNull() || value.type() != type) {
+		return false;
+	}
+	switch (reader.Schema().type) {
+	case Type::INT32: {
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			result = BloomFilterHashPlain<uint32_t>(static_cast<uint32_t>(value.GetValue<int64_t>()));
+			return true;
+		case LogicalTypeId::DATE:
+			result = BloomFilterHashPlain<int32_t>(value.GetValue<date_t>().days);
+			return true;
+		case LogicalTypeId::DECIMAL: {
+			int64_t unscaled;
+			if (!TryGetUnscaledDecimal(value, unscaled)) {
+				return false;
+			}
+			result = BloomFilterHashPlain<uint32_t>(static_cast<uint32_t>(unscaled));
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+	case Type::INT64: {
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+			result = BloomFilterHashPlain<int64_t>(value.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			result = BloomFilterHashPlain<uint64_t>(value.GetValue<uint64_t>());
+			return true;
+		case LogicalTypeId::DECIMAL: {
+			int64_t unscaled;
+			if (!TryGetUnscaledDecimal(value, unscaled)) {
+				return false;
+			}
+			result = BloomFilterHashPlain<int64_t>(unscaled);
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+	case Type::FLOAT: {
+		// -0.0 and 0.0 (as well as all the NaNs) compare equal, but have a different encoding
+		auto float_value = value.GetValue<float>();
+		if (type.id() != LogicalTypeId::FLOAT || float_value == 0 || Value::IsNan(float_value)) {
+			return false;
+		}
+		result = BloomFilterHashPlain<float>(float_value);
+		return true;
+	}
+	case Type::DOUBLE: {
+		auto double_value = value.GetValue<double>();
+		if (type.id() != LogicalTypeId::DOUBLE || double_value == 0 || Value::IsNan(double_value)) {
+			return false;
+		}
+		result = BloomFilterHashPlain<double>(double_value);
+		return true;
+	}
+	case Type::BYTE_ARRAY: {
+		// the plain encoding of a byte array is prefixed by its length, but the hash is computed over the bytes only
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		}
+		auto &str = StringValue::Get(value);
+		result = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+                                                 const ParquetBloomFilter &bloom_filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !TryBloomFilterHash(reader, constant_filter.constant, hash)) {
+			return false;
+		}
+		return !bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludes(reader, *child_filter, bloom_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludes(reader, *child_filter, bloom_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+static uint32_t ReadBloomFilterUnion(duckdb_apache::thrift::protocol::TProtocol &iprot, bool &has_first_member) {
+	using namespace duckdb_apache::thrift::protocol; // NOLINT
+	uint32_t xfer = 0;
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	has_first_member = false;
+	xfer += iprot.readStructBegin(fname);
+	while (true) {
+		xfer += iprot.readFieldBegin(fname, ftype, fid);
+		if (ftype == T_STOP) {
+			break;
+		}
+		has_first_member = has_first_member || (fid == 1 && ftype == T_STRUCT);
+		// the members of the union are all empty structs
+		xfer += iprot.skip(ftype);
+		xfer += iprot.readFieldEnd();
+	}
+	xfer += iprot.readStructEnd();
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::read(duckdb_apache::thrift::protocol::TProtocol *iprot) {
+	using namespace duckdb_apache::thrift::protocol; // NOLINT
+	TInputRecursionTracker tracker(*iprot);
+	uint32_t xfer = 0;
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	bool isset_num_bytes = false;
+	bool isset_algorithm = false;
+	bool isset_hash = false;
+	bool isset_compression = false;
+	supported = true;
+	xfer += iprot->readStructBegin(fname);
+	while (true) {
+		xfer += iprot->readFieldBegin(fname, ftype, fid);
+		if (ftype == T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == T_I32) {
+			xfer += iprot->readI32(num_bytes);
+			isset_num_bytes = true;
+		} else if (fid >= 2 && fid <= 4 && ftype == T_STRUCT) {
+			// only the first members are defined: the BLOCK algorithm, the XXHASH hash and UNCOMPRESSED
+			bool has_first_member;
+			xfer += ReadBloomFilterUnion(*iprot, has_first_member);
+			supported = supported && has_first_member;
+			isset_algorithm = isset_algorithm || fid == 2;
+			isset_hash = isset_hash || fid == 3;
+			isset_compression = isset_compression || fid == 4;
+		} else {
+			xfer += iprot->skip(ftype);
+		}
+		xfer += iprot->readFieldEnd();
+	}
+	xfer += iprot->readStructEnd();
+	if (!isset_num_bytes || !isset_algorithm || !isset_hash || !isset_compression) {
+		throw TProtocolException(TProtocolException::INVALID_DATA);
+	}
+	return xfer;
+}
+
+static uint32_t WriteBloomFilterUnion(duckdb_apache::thrift::protocol::TProtocol &oprot, const char *name,
+                                      int16_t field_id, const char *member_name) {
+	using namespace duckdb_apache::thrift::protocol; // NOLINT
+	uint32_t xfer = 0;
+	xfer += oprot.writeFieldBegin(name, T_STRUCT, field_id);
+	xfer += oprot.writeStructBegin(name);
+	xfer += oprot.writeFieldBegin(member_name, T_STRUCT, 1);
+	xfer += oprot.writeStructBegin(member_name);
+	xfer += oprot.writeFieldStop();
+	xfer += oprot.writeStructEnd();
+	xfer += oprot.writeFieldEnd();
+	xfer += oprot.writeFieldStop();
+	xfer += oprot.writeStructEnd();
+	xfer += oprot.writeFieldEnd();
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::write(duckdb_apache::thrift::protocol::TProtocol *oprot) const {
+	using namespace duckdb_apache::thrift::protocol; // NOLINT
+	TOutputRecursionTracker tracker(*oprot);
+	uint32_t xfer = 0;
+	xfer += oprot->writeStructBegin("BloomFilterHeader");
+	xfer += oprot->writeFieldBegin("numBytes", T_I32, 1);
+	xfer += oprot->writeI32(num_bytes);
+	xfer += oprot->writeFieldEnd();
+	xfer += WriteBloomFilterUnion(*oprot, "algorithm", 2, "BLOCK");
+	xfer += WriteBloomFilterUnion(*oprot, "hash", 3, "XXHASH");
+	xfer += WriteBloomFilterUnion(*oprot, "compression", 4, "UNCOMPRESSED");
+	xfer += oprot->writeFieldStop();
+	xfer += oprot->writeStructEnd();
+	return xfer;
+}
+
+//! The salts of the eight words of a block, as defined by the Parquet format
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(Allocator &allocator, idx_t num_bytes)
+    : data(allocator.Allocate(num_bytes)), block_count(num_bytes / BLOCK_SIZE) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BLOCK_SIZE == 0);
+	memset(data.get(), 0, num_bytes);
+}
+
+idx_t ParquetBloomFilter::OptimalSize(idx_t num_distinct, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// the number of bits for which the probability that all eight bits of a value are set is the false positive ratio
+	auto num_bits = -8.0 * static_cast<double>(num_distinct) / std::log(1 - std::pow(false_positive_ratio, 1.0 / 8));
+	auto num_bytes = static_cast<double>(BLOCK_SIZE) * std::ceil(num_bits / (8.0 * BLOCK_SIZE));
+	if (num_bytes >= static_cast<double>(MAX_BLOOM_FILTER_SIZE)) {
+		return MAX_BLOOM_FILTER_SIZE;
+	}
+	return MaxValue<idx_t>(LossyNumericCast<idx_t>(num_bytes), BLOCK_SIZE);
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto block = reinterpret_cast<uint32_t *>(data.get() + block_idx * BLOCK_SIZE);
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto block = reinterpret_cast<const uint32_t *>(data.get() + block_idx * BLOCK_SIZE);
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
 } // namespace duckdb
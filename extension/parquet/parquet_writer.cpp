@@ -15,6 +15,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #endif
@@ -319,11 +321,16 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
-    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
-      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
+                             bool debug_use_openssl_p, optional_idx page_size_bytes_p,
+                             const vector<string> &bloom_filter_columns_p, double bloom_filter_false_positive_ratio_p,
+                             ParquetVersion parquet_version)
+    : context(context), file_name(std::move(file_name_p)), sql_types(std::move(types_p)),
+      column_names(std::move(names_p)), codec(codec), field_ids(std::move(field_ids_p)),
+      encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p), page_size_bytes(page_size_bytes_p),
+      bloom_filter_columns(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end()),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p), parquet_version(parquet_version) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -392,8 +399,81 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 	}
 }
 
+//! Encodes and compresses a set of columns of a row group
+static void WriteColumns(ColumnDataCollection &buffer, const vector<unique_ptr<ColumnWriter>> &column_writers,
+                         vector<unique_ptr<ColumnWriterState>> &states, idx_t col_start, idx_t col_count) {
+	vector<column_t> column_ids;
+	vector<reference<ColumnWriter>> col_writers;
+	vector<reference<ColumnWriterState>> write_states;
+	for (idx_t i = 0; i < col_count; i++) {
+		column_ids.emplace_back(col_start + i);
+		col_writers.emplace_back(*column_writers[column_ids.back()]);
+		write_states.emplace_back(*states[column_ids.back()]);
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < col_count; i++) {
+			if (col_writers[i].get().HasAnalyze()) {
+				col_writers[i].get().Analyze(write_states[i], nullptr, chunk.data[i], chunk.size());
+			}
+		}
+	}
+
+	for (idx_t i = 0; i < col_count; i++) {
+		if (col_writers[i].get().HasAnalyze()) {
+			col_writers[i].get().FinalizeAnalyze(write_states[i]);
+		}
+	}
+
+	// Reserving these once at the start really pays off
+	for (auto &write_state : write_states) {
+		write_state.get().definition_levels.reserve(buffer.Count());
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < col_count; i++) {
+			col_writers[i].get().Prepare(write_states[i], nullptr, chunk.data[i], chunk.size());
+		}
+	}
+
+	for (idx_t i = 0; i < col_count; i++) {
+		col_writers[i].get().BeginWrite(write_states[i]);
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < col_count; i++) {
+			col_writers[i].get().Write(write_states[i], chunk.data[i], chunk.size());
+		}
+	}
+
+	for (idx_t i = 0; i < col_count; i++) {
+		col_writers[i].get().FinishWrite(write_states[i]);
+	}
+}
+
+class ParquetWriteColumnsTask : public BaseExecutorTask {
+public:
+	ParquetWriteColumnsTask(TaskExecutor &executor, ColumnDataCollection &buffer,
+	                        const vector<unique_ptr<ColumnWriter>> &column_writers,
+	                        vector<unique_ptr<ColumnWriterState>> &states, idx_t col_start, idx_t col_count)
+	    : BaseExecutorTask(executor), buffer(buffer), column_writers(column_writers), states(states),
+	      col_start(col_start), col_count(col_count) {
+	}
+
+	void ExecuteTask() override {
+		WriteColumns(buffer, column_writers, states, col_start, col_count);
+	}
+
+private:
+	ColumnDataCollection &buffer;
+	const vector<unique_ptr<ColumnWriter>> &column_writers;
+	vector<unique_ptr<ColumnWriterState>> &states;
+	idx_t col_start;
+	idx_t col_count;
+};
+
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
-	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
+	// We write at most 8 columns at a time so that iterating over ColumnDataCollection is more efficient
 	static constexpr idx_t COLUMNS_PER_PASS = 8;
 
 	// We want these to be in-memory/hybrid so we don't have to copy over strings to the dictionary
@@ -406,58 +486,29 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 	row_group.total_byte_size = NumericCast<int64_t>(buffer.SizeInBytes());
 	row_group.__isset.file_offset = true;
 
+	// the column chunks are added to the row group in the order of the columns
 	auto &states = result.states;
-	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
-	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
-		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
-		vector<column_t> column_ids;
-		vector<reference<ColumnWriter>> col_writers;
-		vector<unique_ptr<ColumnWriterState>> write_states;
-		for (idx_t i = 0; i < next; i++) {
-			column_ids.emplace_back(col_idx + i);
-			col_writers.emplace_back(*column_writers[column_ids.back()]);
-			write_states.emplace_back(col_writers.back().get().InitializeWriteState(row_group));
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				if (col_writers[i].get().HasAnalyze()) {
-					col_writers[i].get().Analyze(*write_states[i], nullptr, chunk.data[i], chunk.size());
-				}
-			}
-		}
-
-		for (idx_t i = 0; i < next; i++) {
-			if (col_writers[i].get().HasAnalyze()) {
-				col_writers[i].get().FinalizeAnalyze(*write_states[i]);
-			}
-		}
-
-		// Reserving these once at the start really pays off
-		for (auto &write_state : write_states) {
-			write_state->definition_levels.reserve(buffer.Count());
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Prepare(*write_states[i], nullptr, chunk.data[i], chunk.size());
-			}
-		}
-
-		for (idx_t i = 0; i < next; i++) {
-			col_writers[i].get().BeginWrite(*write_states[i]);
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Write(*write_states[i], chunk.data[i], chunk.size());
-			}
-		}
+	for (auto &col_writer : column_writers) {
+		states.push_back(col_writer->InitializeWriteState(row_group));
+	}
 
-		for (auto &write_state : write_states) {
-			states.push_back(std::move(write_state));
+	// the columns are encoded and compressed independently, so we split them over the threads
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	const auto column_count = buffer.ColumnCount();
+	const auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	const auto columns_per_task =
+	    MinValue<idx_t>(COLUMNS_PER_PASS, MaxValue<idx_t>((column_count + thread_count - 1) / thread_count, 1));
+	if (columns_per_task >= column_count) {
+		WriteColumns(buffer, column_writers, states, 0, column_count);
+	} else {
+		TaskExecutor executor(scheduler);
+		for (idx_t col_idx = 0; col_idx < column_count; col_idx += columns_per_task) {
+			const auto next = MinValue<idx_t>(column_count - col_idx, columns_per_task);
+			executor.ScheduleTask(
+			    make_uniq<ParquetWriteColumnsTask>(executor, buffer, column_writers, states, col_idx, next));
 		}
+		executor.WorkOnTasks();
 	}
 	result.heaps = buffer.GetHeapReferences();
 }
@@ -533,7 +584,51 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+bool ParquetWriter::HasBloomFilter(const vector<string> &schema_path) const {
+	if (bloom_filter_columns.empty() || encryption_config) {
+		// we do not encrypt Bloom filters, so we do not write them for encrypted files
+		return false;
+	}
+	// nested columns are identified by their dot-separated path, e.g., "s.a"
+	return bloom_filter_columns.find(StringUtil::Join(schema_path, ".")) != bloom_filter_columns.end();
+}
+
+void ParquetWriter::AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                 duckdb_parquet::format::OffsetIndex offset_index) {
+	if (encryption_config) {
+		// we do not encrypt page indexes, so we do not write them for encrypted files
+		return;
+	}
+	// this is called while flushing a row group (i.e., while holding the lock) - before it is added to the metadata
+	ParquetPageIndex page_index;
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_index.column_idx = column_idx;
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+	page_indexes.push_back(std::move(page_index));
+}
+
 void ParquetWriter::Finalize() {
+	// write the page indexes between the row groups and the footer: first the column indexes, then the offset indexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		page_index.column_index->write(protocol.get());
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		page_index.offset_index.write(protocol.get());
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	page_indexes.clear();
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -324,6 +324,9 @@ SequenceException::SequenceException(const string &msg) : Exception(ExceptionTyp
 InterruptException::InterruptException() : Exception(ExceptionType::INTERRUPT, "Interrupted!") {
 }
 
+InterruptException::InterruptException(const string &msg) : Exception(ExceptionType::INTERRUPT, msg) {
+}
+
 FatalException::FatalException(ExceptionType type, const string &msg) : Exception(type, msg) {
 }
 
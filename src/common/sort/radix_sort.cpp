@@ -106,39 +106,43 @@ static void ComputeTies(data_ptr_t dataptr, const idx_t &count, const idx_t &col
 	}
 }
 
-//! Textbook LSD radix sort
+//! LSD radix sort that collects the counts of all radixes in a single pass over the data
 void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                   const idx_t &row_width, const idx_t &sorting_size) {
+	D_ASSERT(sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD);
+	// Collect counts for every radix at once, so we only have to read the data once before re-ordering it
+	idx_t counts[SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD][SortConstants::VALUES_PER_RADIX];
+	memset(counts, 0, sizeof(counts));
+	data_ptr_t offset_ptr = dataptr + col_offset;
+	for (idx_t i = 0; i < count; i++) {
+		for (idx_t r = 0; r < sorting_size; r++) {
+			counts[r][offset_ptr[r]]++;
+		}
+		offset_ptr += row_width;
+	}
+
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate(count * row_width);
 	bool swap = false;
-
-	idx_t counts[SortConstants::VALUES_PER_RADIX];
 	for (idx_t r = 1; r <= sorting_size; r++) {
-		// Init counts to 0
-		memset(counts, 0, sizeof(counts));
 		// Const some values for convenience
 		const data_ptr_t source_ptr = swap ? temp_block.get() : dataptr;
 		const data_ptr_t target_ptr = swap ? dataptr : temp_block.get();
 		const idx_t offset = col_offset + sorting_size - r;
-		// Collect counts
-		data_ptr_t offset_ptr = source_ptr + offset;
-		for (idx_t i = 0; i < count; i++) {
-			counts[*offset_ptr]++;
-			offset_ptr += row_width;
-		}
 		// Compute offsets from counts
-		idx_t max_count = counts[0];
+		auto radix_counts = counts[sorting_size - r];
+		idx_t max_count = radix_counts[0];
 		for (idx_t val = 1; val < SortConstants::VALUES_PER_RADIX; val++) {
-			max_count = MaxValue<idx_t>(max_count, counts[val]);
-			counts[val] = counts[val] + counts[val - 1];
+			max_count = MaxValue<idx_t>(max_count, radix_counts[val]);
+			radix_counts[val] = radix_counts[val] + radix_counts[val - 1];
 		}
 		if (max_count == count) {
+			// All values have the same radix, nothing to re-order
 			continue;
 		}
 		// Re-order the data in temporary array
 		data_ptr_t row_ptr = source_ptr + (count - 1) * row_width;
 		for (idx_t i = 0; i < count; i++) {
-			idx_t &radix_offset = --counts[*(row_ptr + offset)];
+			idx_t &radix_offset = --radix_counts[*(row_ptr + offset)];
 			FastMemcpy(target_ptr + radix_offset * row_width, row_ptr, row_width);
 			row_ptr -= row_width;
 		}
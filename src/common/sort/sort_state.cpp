@@ -72,13 +72,14 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			idx_t size_before = col_size;
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
+				if (col_size > SortConstants::MAX_NORMALIZED_STRING_SIZE) {
+					col_size = SortConstants::STRING_PREFIX_SIZE;
 				} else {
+					// short enough to store the full string in the sorting key
 					constant_size.back() = true;
 				}
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_PREFIX_SIZE;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
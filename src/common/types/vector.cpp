@@ -229,6 +229,7 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		// already a dictionary, slice the current dictionary
 		auto &current_sel = DictionaryVector::SelVector(*this);
+		auto dictionary_size = DictionaryVector::DictionarySize(*this);
 		auto sliced_dictionary = current_sel.Slice(sel, count);
 		buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
 		if (GetType().InternalType() == PhysicalType::STRUCT) {
@@ -237,6 +238,9 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 			Vector new_child(child_vector);
 			new_child.auxiliary = make_buffer<VectorStructBuffer>(new_child, sel, count);
 			auxiliary = make_buffer<VectorChildBuffer>(std::move(new_child));
+		} else if (dictionary_size.IsValid()) {
+			// the child is unchanged, so the dictionary size still applies
+			DictionaryVector::SetDictionarySize(*this, dictionary_size.GetIndex());
 		}
 		return;
 	}
@@ -267,8 +271,12 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 		auto entry = cache.cache.find(target_data);
 		if (entry != cache.cache.end()) {
 			// cached entry exists: use that
-			this->buffer = make_buffer<DictionaryBuffer>(entry->second->Cast<DictionaryBuffer>().GetSelVector());
+			auto &cached_buffer = entry->second->Cast<DictionaryBuffer>();
+			this->buffer = make_buffer<DictionaryBuffer>(cached_buffer.GetSelVector());
 			vector_type = VectorType::DICTIONARY_VECTOR;
+			if (cached_buffer.GetDictionarySize().IsValid()) {
+				DictionaryVector::SetDictionarySize(*this, cached_buffer.GetDictionarySize().GetIndex());
+			}
 		} else {
 			Slice(sel, count);
 			cache.cache[target_data] = this->buffer;
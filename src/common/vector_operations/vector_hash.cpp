@@ -313,7 +313,36 @@ static inline void HashTypeSwitch(Vector &input, Vector &result, const Selection
 	}
 }
 
+//! For string dictionaries that have fewer entries than there are rows, hash every dictionary entry once
+//! The hash of a row can then be looked up using the dictionary selection
+static bool TryHashDictionary(Vector &input, idx_t count, Vector &dictionary_hashes, UnifiedVectorFormat &hdata) {
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR ||
+	    input.GetType().InternalType() != PhysicalType::VARCHAR) {
+		return false;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= count) {
+		return false;
+	}
+	dictionary_hashes.Initialize(false, dictionary_size.GetIndex());
+	HashTypeSwitch<false>(DictionaryVector::Child(input), dictionary_hashes, nullptr, dictionary_size.GetIndex());
+	dictionary_hashes.ToUnifiedFormat(dictionary_size.GetIndex(), hdata);
+	return true;
+}
+
 void VectorOperations::Hash(Vector &input, Vector &result, idx_t count) {
+	Vector dictionary_hashes(LogicalType::HASH, nullptr);
+	UnifiedVectorFormat hdata;
+	if (TryHashDictionary(input, count, dictionary_hashes, hdata)) {
+		auto &sel = DictionaryVector::SelVector(input);
+		auto dictionary_hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		auto result_data = FlatVector::GetData<hash_t>(result);
+		for (idx_t i = 0; i < count; i++) {
+			result_data[i] = dictionary_hash_data[hdata.sel->get_index(sel.get_index(i))];
+		}
+		return;
+	}
 	HashTypeSwitch<false>(input, result, nullptr, count);
 }
 
@@ -453,6 +482,30 @@ static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const Se
 }
 
 void VectorOperations::CombineHash(Vector &hashes, Vector &input, idx_t count) {
+	Vector dictionary_hashes(LogicalType::HASH, nullptr);
+	UnifiedVectorFormat hdata;
+	if (TryHashDictionary(input, count, dictionary_hashes, hdata)) {
+		D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+		auto &sel = DictionaryVector::SelVector(input);
+		auto dictionary_hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+		if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
+			hashes.SetVectorType(VectorType::FLAT_VECTOR);
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			for (idx_t i = 0; i < count; i++) {
+				auto other_hash = dictionary_hash_data[hdata.sel->get_index(sel.get_index(i))];
+				hash_data[i] = CombineHashScalar(constant_hash, other_hash);
+			}
+		} else {
+			D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			for (idx_t i = 0; i < count; i++) {
+				auto other_hash = dictionary_hash_data[hdata.sel->get_index(sel.get_index(i))];
+				hash_data[i] = CombineHashScalar(hash_data[i], other_hash);
+			}
+		}
+		return;
+	}
 	CombineHashTypeSwitch<false>(hashes, input, nullptr, count);
 }
 
@@ -18,6 +18,9 @@ ScalarFunction VectorTypeFun::GetFunction() {
 	                                      LogicalType::VARCHAR, // return type
 	                                      VectorTypeFunction);
 	vector_type_fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	// the result depends on the physical representation of the input, so it must not be folded or evaluated once for
+	// every entry of a dictionary
+	vector_type_fun.stability = FunctionStability::VOLATILE;
 	return vector_type_fun;
 }
 
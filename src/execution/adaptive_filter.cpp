@@ -2,33 +2,30 @@
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/pair.hpp"
 #include "duckdb/common/vector.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
-AdaptiveFilter::AdaptiveFilter(const Expression &expr) : observe_interval(10), execute_interval(20), warmup(true) {
+AdaptiveFilter::AdaptiveFilter(const Expression &expr) {
 	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
 	D_ASSERT(conj_expr.children.size() > 1);
 	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
 		permutation.push_back(idx);
-		if (idx != conj_expr.children.size() - 1) {
-			swap_likeliness.push_back(100);
-		}
 	}
-	right_random_border = 100 * (conj_expr.children.size() - 1);
+	statistics.resize(permutation.size());
 }
 
-AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters)
-    : observe_interval(10), execute_interval(20), warmup(true) {
+AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters) {
 	for (idx_t idx = 0; idx < table_filters.filters.size(); idx++) {
 		permutation.push_back(idx);
-		swap_likeliness.push_back(100);
 	}
-	swap_likeliness.pop_back();
-	right_random_border = 100 * (table_filters.filters.size() - 1);
+	statistics.resize(permutation.size());
 }
 
-AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
+AdaptiveFilterState AdaptiveFilter::BeginPredicate() const {
 	if (permutation.size() <= 1) {
 		return AdaptiveFilterState();
 	}
@@ -37,73 +34,55 @@ AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
 	return state;
 }
 
-void AdaptiveFilter::EndFilter(AdaptiveFilterState state) {
+void AdaptiveFilter::EndPredicate(AdaptiveFilterState state, idx_t predicate_idx, idx_t input_count,
+                                  idx_t eliminated_count) {
 	if (permutation.size() <= 1) {
 		// nothing to permute
 		return;
 	}
 	auto end_time = high_resolution_clock::now();
-	AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - state.start_time).count());
+	auto &predicate_stats = statistics[predicate_idx];
+	predicate_stats.runtime += duration_cast<duration<double>>(end_time - state.start_time).count();
+	predicate_stats.input_count += static_cast<double>(input_count);
+	predicate_stats.eliminated_count += static_cast<double>(eliminated_count);
 }
 
-void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
+void AdaptiveFilter::EndFilter() {
+	if (permutation.size() <= 1) {
+		return;
+	}
 	iteration_count++;
-	runtime_sum += duration;
-
-	if (!warmup) {
-		// the last swap was observed
-		if (observe && iteration_count == observe_interval) {
-			// keep swap if runtime decreased, else reverse swap
-			if (prev_mean - (runtime_sum / static_cast<double>(iteration_count)) <= 0) {
-				// reverse swap because runtime didn't decrease
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// decrease swap likeliness, but make sure there is always a small likeliness left
-				if (swap_likeliness[swap_idx] > 1) {
-					swap_likeliness[swap_idx] /= 2;
-				}
-			} else {
-				// keep swap because runtime decreased, reset likeliness
-				swap_likeliness[swap_idx] = 100;
-			}
-			observe = false;
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		} else if (!observe && iteration_count == execute_interval) {
-			// save old mean to evaluate swap
-			prev_mean = runtime_sum / static_cast<double>(iteration_count);
-
-			// get swap index and swap likeliness
-			// a <= i <= b
-			auto random_number = generator.NextRandomInteger(1, NumericCast<uint32_t>(right_random_border));
-
-			swap_idx = random_number / 100;                    // index to be swapped
-			idx_t likeliness = random_number - 100 * swap_idx; // random number between [0, 100)
-
-			// check if swap is going to happen
-			if (swap_likeliness[swap_idx] > likeliness) { // always true for the first swap of an index
-				// swap
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// observe whether swap will be applied
-				observe = true;
-			}
+	if (iteration_count < REORDER_INTERVAL) {
+		return;
+	}
+	ReorderPredicates();
+	iteration_count = 0;
+}
 
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		}
-	} else {
-		if (iteration_count == 5) {
-			// initially set all values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-			observe = false;
-			warmup = false;
+void AdaptiveFilter::ReorderPredicates() {
+	// for independent predicates, evaluating them in ascending order of cost per eliminated tuple is optimal
+	// predicates that have not been evaluated (because the preceding predicates eliminated all tuples) are moved to
+	// the front so their statistics are measured, predicates that do not eliminate anything are moved to the back
+	vector<pair<idx_t, double>> ranks;
+	ranks.reserve(statistics.size());
+	for (auto &predicate_stats : statistics) {
+		if (predicate_stats.input_count == 0) {
+			ranks.emplace_back(0, 0);
+		} else if (predicate_stats.eliminated_count == 0) {
+			ranks.emplace_back(2, predicate_stats.runtime / predicate_stats.input_count);
+		} else {
+			ranks.emplace_back(1, predicate_stats.runtime / predicate_stats.eliminated_count);
 		}
 	}
+	std::stable_sort(permutation.begin(), permutation.end(),
+	                 [&](const idx_t &lhs, const idx_t &rhs) { return ranks[lhs] < ranks[rhs]; });
+
+	// decay the statistics so that the order adapts to changes in the data
+	for (auto &predicate_stats : statistics) {
+		predicate_stats.runtime *= STATISTICS_DECAY;
+		predicate_stats.input_count *= STATISTICS_DECAY;
+		predicate_stats.eliminated_count *= STATISTICS_DECAY;
+	}
 }
 
 } // namespace duckdb
@@ -9,26 +9,25 @@
 
 namespace duckdb {
 
+ExecuteComparisonState::ExecuteComparisonState(const Expression &expr, ExpressionExecutorState &root)
+    : ExpressionState(expr, root) {
+}
+
+ExecuteComparisonState::~ExecuteComparisonState() {
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundComparisonExpression &expr,
                                                                 ExpressionExecutorState &root) {
-	auto result = make_uniq<ExpressionState>(expr, root);
+	auto result = make_uniq<ExecuteComparisonState>(expr, root);
 	result->AddChild(expr.left.get());
 	result->AddChild(expr.right.get());
 	result->Finalize();
-	return result;
+	result->fused = FusedComparison::TryCreate(expr, *result);
+	return std::move(result);
 }
 
-void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, ExpressionState *state,
-                                 const SelectionVector *sel, idx_t count, Vector &result) {
-	// resolve the children
-	state->intermediate_chunk.Reset();
-	auto &left = state->intermediate_chunk.data[0];
-	auto &right = state->intermediate_chunk.data[1];
-
-	Execute(*expr.left, state->child_states[0].get(), sel, count, left);
-	Execute(*expr.right, state->child_states[1].get(), sel, count, right);
-
-	switch (expr.type) {
+static void ExecuteComparison(ExpressionType type, Vector &left, Vector &right, Vector &result, idx_t count) {
+	switch (type) {
 	case ExpressionType::COMPARE_EQUAL:
 		VectorOperations::Equals(left, right, result, count);
 		break;
@@ -58,6 +57,82 @@ void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, Expressi
 	}
 }
 
+//! Whether or not the comparison can be computed once for every entry of a dictionary instead of once for every row
+//! This is the case if one side is a dictionary vector with fewer entries than there are rows, and the other is
+//! constant
+static optional_ptr<Vector> GetComparisonDictionary(Vector &left, Vector &right, idx_t count) {
+	auto is_dictionary = [&](Vector &input, Vector &other) {
+		if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR ||
+		    other.GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			return false;
+		}
+		auto dictionary_size = DictionaryVector::DictionarySize(input);
+		return dictionary_size.IsValid() && dictionary_size.GetIndex() < count;
+	};
+	if (is_dictionary(left, right)) {
+		return &left;
+	}
+	if (is_dictionary(right, left)) {
+		return &right;
+	}
+	return nullptr;
+}
+
+//! Compares every entry of the dictionary with the constant
+static void ExecuteDictionaryComparison(ExpressionType type, Vector &left, Vector &right, Vector &dictionary,
+                                        Vector &dictionary_result) {
+	auto &child = DictionaryVector::Child(dictionary);
+	auto dictionary_size = DictionaryVector::DictionarySize(dictionary).GetIndex();
+	if (&dictionary == &left) {
+		ExecuteComparison(type, child, right, dictionary_result, dictionary_size);
+	} else {
+		ExecuteComparison(type, left, child, dictionary_result, dictionary_size);
+	}
+}
+
+void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, ExpressionState *state,
+                                 const SelectionVector *sel, idx_t count, Vector &result) {
+	// resolve the children
+	state->intermediate_chunk.Reset();
+	auto &left = state->intermediate_chunk.data[0];
+	auto &right = state->intermediate_chunk.data[1];
+
+	auto &fused = state->Cast<ExecuteComparisonState>().fused;
+	if (fused) {
+		idx_t true_count;
+		if (ExecuteFusedLeaves(*fused, sel, count) &&
+		    fused->kernel(fused->inputs.data(), nullptr, count, &fused->true_sel, nullptr, true_count)) {
+			// the fused kernel selected the rows for which the comparison holds
+			result.SetVectorType(VectorType::FLAT_VECTOR);
+			auto result_data = FlatVector::GetData<bool>(result);
+			FlatVector::Validity(result).Reset();
+			memset(result_data, 0, count * sizeof(bool));
+			for (idx_t i = 0; i < true_count; i++) {
+				result_data[fused->true_sel.get_index(i)] = true;
+			}
+			return;
+		}
+		ExecuteFusedChildren(*fused, count, left, right);
+	} else {
+		Execute(*expr.left, state->child_states[0].get(), sel, count, left);
+		Execute(*expr.right, state->child_states[1].get(), sel, count, right);
+	}
+
+	auto dictionary = GetComparisonDictionary(left, right, count);
+	if (dictionary) {
+		// compare the dictionary entries and slice the result with the dictionary selection
+		auto dictionary_size = DictionaryVector::DictionarySize(*dictionary).GetIndex();
+		Vector dictionary_result(LogicalType::BOOLEAN, dictionary_size);
+		ExecuteDictionaryComparison(expr.type, left, right, *dictionary, dictionary_result);
+		result.Slice(dictionary_result, DictionaryVector::SelVector(*dictionary), count);
+		if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+			DictionaryVector::SetDictionarySize(result, dictionary_size);
+		}
+		return;
+	}
+	ExecuteComparison(expr.type, left, right, result, count);
+}
+
 static void UpdateNullMask(Vector &vec, optional_ptr<const SelectionVector> sel, idx_t count, ValidityMask &null_mask) {
 	UnifiedVectorFormat vdata;
 	vec.ToUnifiedFormat(count, vdata);
@@ -353,8 +428,49 @@ idx_t ExpressionExecutor::Select(const BoundComparisonExpression &expr, Expressi
 	auto &left = state->intermediate_chunk.data[0];
 	auto &right = state->intermediate_chunk.data[1];
 
-	Execute(*expr.left, state->child_states[0].get(), sel, count, left);
-	Execute(*expr.right, state->child_states[1].get(), sel, count, right);
+	auto &fused = state->Cast<ExecuteComparisonState>().fused;
+	if (fused) {
+		idx_t true_count;
+		if (ExecuteFusedLeaves(*fused, sel, count) &&
+		    fused->kernel(fused->inputs.data(), sel, count, true_sel, false_sel, true_count)) {
+			return true_count;
+		}
+		ExecuteFusedChildren(*fused, count, left, right);
+	} else {
+		Execute(*expr.left, state->child_states[0].get(), sel, count, left);
+		Execute(*expr.right, state->child_states[1].get(), sel, count, right);
+	}
+
+	auto dictionary = GetComparisonDictionary(left, right, count);
+	if (dictionary) {
+		// compare the dictionary entries, then select the rows based on the entry they point to
+		auto dictionary_size = DictionaryVector::DictionarySize(*dictionary).GetIndex();
+		Vector dictionary_result(LogicalType::BOOLEAN, dictionary_size);
+		ExecuteDictionaryComparison(expr.type, left, right, *dictionary, dictionary_result);
+
+		UnifiedVectorFormat rdata;
+		dictionary_result.ToUnifiedFormat(dictionary_size, rdata);
+		auto result_data = UnifiedVectorFormat::GetData<bool>(rdata);
+		auto &dictionary_sel = DictionaryVector::SelVector(*dictionary);
+		idx_t true_count = 0;
+		idx_t false_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			auto result_idx = sel ? sel->get_index(i) : i;
+			auto entry_idx = rdata.sel->get_index(dictionary_sel.get_index(i));
+			if (rdata.validity.RowIsValid(entry_idx) && result_data[entry_idx]) {
+				if (true_sel) {
+					true_sel->set_index(true_count, result_idx);
+				}
+				true_count++;
+			} else {
+				if (false_sel) {
+					false_sel->set_index(false_count, result_idx);
+				}
+				false_count++;
+			}
+		}
+		return true_count;
+	}
 
 	switch (expr.type) {
 	case ExpressionType::COMPARE_EQUAL:
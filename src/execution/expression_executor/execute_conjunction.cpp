@@ -57,9 +57,8 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
                                  SelectionVector *false_sel) {
 	auto &state = state_p->Cast<ConjunctionState>();
 
+	auto &adaptive_filter = *state.adaptive_filter;
 	if (expr.type == ExpressionType::CONJUNCTION_AND) {
-		// get runtime statistics
-		auto filter_state = state.adaptive_filter->BeginFilter();
 		const SelectionVector *current_sel = sel;
 		idx_t current_count = count;
 		idx_t false_count = 0;
@@ -73,10 +72,12 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			true_sel = temp_true.get();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
-			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
-			                      state.child_states[state.adaptive_filter->permutation[i]].get(), current_sel,
+			auto child_idx = adaptive_filter.permutation[i];
+			auto filter_state = adaptive_filter.BeginPredicate();
+			idx_t tcount = Select(*expr.children[child_idx], state.child_states[child_idx].get(), current_sel,
 			                      current_count, true_sel, temp_false.get());
 			idx_t fcount = current_count - tcount;
+			adaptive_filter.EndPredicate(filter_state, child_idx, current_count, fcount);
 			if (fcount > 0 && false_sel) {
 				// move failing tuples into the false_sel
 				// tuples passed, move them into the actual result vector
@@ -94,13 +95,10 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 				current_sel = true_sel;
 			}
 		}
-		// adapt runtime statistics
-		state.adaptive_filter->EndFilter(filter_state);
+		// adapt the order of the children
+		adaptive_filter.EndFilter();
 		return current_count;
 	} else {
-		// get runtime statistics
-		auto filter_state = state.adaptive_filter->BeginFilter();
-
 		const SelectionVector *current_sel = sel;
 		idx_t current_count = count;
 		idx_t result_count = 0;
@@ -114,9 +112,11 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			false_sel = temp_false.get();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
-			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
-			                      state.child_states[state.adaptive_filter->permutation[i]].get(), current_sel,
+			auto child_idx = adaptive_filter.permutation[i];
+			auto filter_state = adaptive_filter.BeginPredicate();
+			idx_t tcount = Select(*expr.children[child_idx], state.child_states[child_idx].get(), current_sel,
 			                      current_count, temp_true.get(), false_sel);
+			adaptive_filter.EndPredicate(filter_state, child_idx, current_count, tcount);
 			if (tcount > 0) {
 				if (true_sel) {
 					// tuples passed, move them into the actual result vector
@@ -128,10 +128,14 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 				current_count -= tcount;
 				current_sel = false_sel;
 			}
+			if (current_count == 0) {
+				// all tuples passed: the remaining children do not need to be evaluated
+				break;
+			}
 		}
 
-		// adapt runtime statistics
-		state.adaptive_filter->EndFilter(filter_state);
+		// adapt the order of the children
+		adaptive_filter.EndFilter();
 		return result_count;
 	}
 }
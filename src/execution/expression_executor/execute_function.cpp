@@ -56,6 +56,73 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 #endif
 }
 
+//! Try to execute the function once for every entry of a dictionary, instead of once for every row
+//! This is possible if one argument is a dictionary vector of a known size and all other arguments are constant
+static bool TryExecuteDictionary(const BoundFunctionExpression &expr, ExecuteFunctionState &state, DataChunk &arguments,
+                                 idx_t count, Vector &result) {
+	if (!state.dictionary_execution || expr.IsVolatile()) {
+		return false;
+	}
+	optional_idx dictionary_idx;
+	bool cacheable = true;
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		auto &arg = arguments.data[i];
+		if (arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			// the result can only be reused across chunks if the constants do not change
+			cacheable = cacheable && expr.children[i]->IsFoldable();
+			continue;
+		}
+		if (arg.GetVectorType() != VectorType::DICTIONARY_VECTOR || dictionary_idx.IsValid() ||
+		    !DictionaryVector::DictionarySize(arg).IsValid()) {
+			return false;
+		}
+		dictionary_idx = i;
+	}
+	if (!dictionary_idx.IsValid()) {
+		return false;
+	}
+	auto &dict_arg = arguments.data[dictionary_idx.GetIndex()];
+	auto &dictionary = DictionaryVector::Child(dict_arg);
+	auto dictionary_size = DictionaryVector::DictionarySize(dict_arg).GetIndex();
+	auto &sel = DictionaryVector::SelVector(dict_arg);
+	if (cacheable && state.cached_dictionary && state.cached_dictionary.get() == dictionary.GetBuffer().get()) {
+		// we have already computed the result for this dictionary
+		result.Slice(*state.cached_dictionary_result, sel, count);
+		return true;
+	}
+	if (dictionary_size > count) {
+		// the dictionary is larger than the chunk - executing it is not cheaper
+		return false;
+	}
+	DataChunk dictionary_args;
+	dictionary_args.InitializeEmpty(arguments.GetTypes());
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		dictionary_args.data[i].Reference(i == dictionary_idx.GetIndex() ? dictionary : arguments.data[i]);
+	}
+	dictionary_args.SetCardinality(dictionary_size);
+	auto dictionary_result = make_uniq<Vector>(result.GetType(), dictionary_size);
+	try {
+		expr.function.function(dictionary_args, state, *dictionary_result);
+	} catch (InternalException &ex) {
+		throw;
+	} catch (...) {
+		// the function failed on one of the dictionary entries - this entry might not be referenced by any row
+		// fall back to executing the function row-by-row
+		state.dictionary_execution = false;
+		return false;
+	}
+	VerifyNullHandling(expr, dictionary_args, *dictionary_result);
+	result.Slice(*dictionary_result, sel, count);
+	if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		DictionaryVector::SetDictionarySize(result, dictionary_size);
+	}
+	if (cacheable) {
+		state.cached_dictionary = dictionary.GetBuffer();
+		state.cached_dictionary_result = std::move(dictionary_result);
+	}
+	return true;
+}
+
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
 	state->intermediate_chunk.Reset();
@@ -75,6 +142,10 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
+	if (TryExecuteDictionary(expr, state->Cast<ExecuteFunctionState>(), arguments, count, result)) {
+		D_ASSERT(result.GetType() == expr.return_type);
+		return;
+	}
 	expr.function.function(arguments, *state, result);
 
 	VerifyNullHandling(expr, arguments, result);
@@ -0,0 +1,378 @@
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Fused Operators
+//===--------------------------------------------------------------------===//
+// The operators have the same semantics as the bound arithmetic functions, but are inlined into the fused kernels
+// Overflows are not thrown here - the kernel bails out, and the comparison is evaluated by the regular functions
+struct FusedAdd {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return TryAddOperator::Operation(left, right, result);
+	}
+};
+
+struct FusedSubtract {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return TrySubtractOperator::Operation(left, right, result);
+	}
+};
+
+struct FusedMultiply {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return TryMultiplyOperator::Operation(left, right, result);
+	}
+};
+
+static inline bool FusedNarrow(int64_t value, int32_t &result) {
+	if (value < NumericLimits<int32_t>::Minimum() || value > NumericLimits<int32_t>::Maximum()) {
+		return false;
+	}
+	result = int32_t(value);
+	return true;
+}
+
+template <>
+inline bool FusedAdd::Operation(int32_t left, int32_t right, int32_t &result) {
+	return FusedNarrow(int64_t(left) + int64_t(right), result);
+}
+
+template <>
+inline bool FusedSubtract::Operation(int32_t left, int32_t right, int32_t &result) {
+	return FusedNarrow(int64_t(left) - int64_t(right), result);
+}
+
+template <>
+inline bool FusedMultiply::Operation(int32_t left, int32_t right, int32_t &result) {
+	return FusedNarrow(int64_t(left) * int64_t(right), result);
+}
+
+#if (__GNUC__ >= 5) || defined(__clang__)
+template <>
+inline bool FusedAdd::Operation(int64_t left, int64_t right, int64_t &result) {
+	return !__builtin_add_overflow(left, right, &result);
+}
+
+template <>
+inline bool FusedSubtract::Operation(int64_t left, int64_t right, int64_t &result) {
+	return !__builtin_sub_overflow(left, right, &result);
+}
+
+template <>
+inline bool FusedMultiply::Operation(int64_t left, int64_t right, int64_t &result) {
+	return !__builtin_mul_overflow(left, right, &result);
+}
+#endif
+
+template <>
+inline bool FusedAdd::Operation(double left, double right, double &result) {
+	result = left + right;
+	return true;
+}
+
+template <>
+inline bool FusedSubtract::Operation(double left, double right, double &result) {
+	result = left - right;
+	return true;
+}
+
+template <>
+inline bool FusedMultiply::Operation(double left, double right, double &result) {
+	result = left * right;
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Fused Kernels
+//===--------------------------------------------------------------------===//
+template <class T>
+static inline T FusedGet(const FusedInput &input, idx_t i) {
+	return reinterpret_cast<const T *>(input.data)[i * input.stride];
+}
+
+//! a OP b
+template <class T, class OP>
+struct FusedTree1 {
+	static constexpr idx_t LEAF_COUNT = 2;
+
+	static inline bool Evaluate(const FusedInput inputs[], idx_t i, T &result) {
+		return OP::Operation(FusedGet<T>(inputs[0], i), FusedGet<T>(inputs[1], i), result);
+	}
+};
+
+//! (a OP1 b) OP2 c
+template <class T, class OP1, class OP2>
+struct FusedTree2 {
+	static constexpr idx_t LEAF_COUNT = 3;
+
+	static inline bool Evaluate(const FusedInput inputs[], idx_t i, T &result) {
+		T nested;
+		if (!OP1::Operation(FusedGet<T>(inputs[0], i), FusedGet<T>(inputs[1], i), nested)) {
+			return false;
+		}
+		return OP2::Operation(nested, FusedGet<T>(inputs[2], i), result);
+	}
+};
+
+template <class T, class TREE, class CMP>
+static bool FusedSelect(const FusedInput inputs[], const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+                        SelectionVector *false_sel, idx_t &true_count) {
+	auto &other = inputs[TREE::LEAF_COUNT];
+	idx_t true_idx = 0;
+	idx_t false_idx = 0;
+	for (idx_t i = 0; i < count; i++) {
+		T value;
+		if (!TREE::Evaluate(inputs, i, value)) {
+			return false;
+		}
+		bool comparison_result = CMP::Operation(value, FusedGet<T>(other, i));
+		auto result_idx = sel ? sel->get_index(i) : i;
+		if (true_sel) {
+			true_sel->set_index(true_idx, result_idx);
+		}
+		if (false_sel) {
+			false_sel->set_index(false_idx, result_idx);
+		}
+		true_idx += comparison_result;
+		false_idx += !comparison_result;
+	}
+	true_count = true_idx;
+	return true;
+}
+
+enum class FusedOperator : uint8_t { ADD, SUBTRACT, MULTIPLY };
+
+template <class T, class TREE>
+static fused_select_t GetFusedComparisonKernel(ExpressionType comparison) {
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return FusedSelect<T, TREE, duckdb::Equals>;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return FusedSelect<T, TREE, duckdb::NotEquals>;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return FusedSelect<T, TREE, duckdb::LessThan>;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return FusedSelect<T, TREE, duckdb::GreaterThan>;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return FusedSelect<T, TREE, duckdb::LessThanEquals>;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return FusedSelect<T, TREE, duckdb::GreaterThanEquals>;
+	default:
+		return nullptr;
+	}
+}
+
+template <class T, class OP1>
+static fused_select_t GetFusedTreeKernel(const vector<FusedOperator> &operators, ExpressionType comparison) {
+	if (operators.size() == 1) {
+		return GetFusedComparisonKernel<T, FusedTree1<T, OP1>>(comparison);
+	}
+	switch (operators[1]) {
+	case FusedOperator::ADD:
+		return GetFusedComparisonKernel<T, FusedTree2<T, OP1, FusedAdd>>(comparison);
+	case FusedOperator::SUBTRACT:
+		return GetFusedComparisonKernel<T, FusedTree2<T, OP1, FusedSubtract>>(comparison);
+	case FusedOperator::MULTIPLY:
+		return GetFusedComparisonKernel<T, FusedTree2<T, OP1, FusedMultiply>>(comparison);
+	default:
+		return nullptr;
+	}
+}
+
+template <class T>
+static fused_select_t GetFusedKernel(const vector<FusedOperator> &operators, ExpressionType comparison) {
+	switch (operators[0]) {
+	case FusedOperator::ADD:
+		return GetFusedTreeKernel<T, FusedAdd>(operators, comparison);
+	case FusedOperator::SUBTRACT:
+		return GetFusedTreeKernel<T, FusedSubtract>(operators, comparison);
+	case FusedOperator::MULTIPLY:
+		return GetFusedTreeKernel<T, FusedMultiply>(operators, comparison);
+	default:
+		return nullptr;
+	}
+}
+
+static fused_select_t GetFusedKernel(PhysicalType type, const vector<FusedOperator> &operators,
+                                     ExpressionType comparison) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return GetFusedKernel<int32_t>(operators, comparison);
+	case PhysicalType::INT64:
+		return GetFusedKernel<int64_t>(operators, comparison);
+	case PhysicalType::DOUBLE:
+		return GetFusedKernel<double>(operators, comparison);
+	default:
+		return nullptr;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Fused Comparison
+//===--------------------------------------------------------------------===//
+//! Whether the expression is an arithmetic operator that can be part of a fused kernel of the given type
+static bool GetFusedOperator(const Expression &expr, const LogicalType &type, FusedOperator &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &function = expr.Cast<BoundFunctionExpression>();
+	if (function.children.size() != 2 || function.return_type != type) {
+		return false;
+	}
+	for (auto &child : function.children) {
+		if (child->return_type != type) {
+			return false;
+		}
+	}
+	auto &name = function.function.name;
+	if (name == "+" || name == "add") {
+		result = FusedOperator::ADD;
+	} else if (name == "-" || name == "subtract") {
+		result = FusedOperator::SUBTRACT;
+	} else if (name == "*" || name == "multiply") {
+		result = FusedOperator::MULTIPLY;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+unique_ptr<FusedComparison> FusedComparison::TryCreate(const BoundComparisonExpression &expr,
+                                                       ExpressionState &state) {
+	auto &type = expr.left->return_type;
+	if (type != expr.right->return_type) {
+		return nullptr;
+	}
+	switch (type.id()) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DOUBLE:
+		break;
+	default:
+		return nullptr;
+	}
+	auto result = make_uniq<FusedComparison>();
+	auto comparison = expr.type;
+	vector<FusedOperator> operators;
+	FusedOperator top_operator;
+	if (GetFusedOperator(*expr.left, type, top_operator)) {
+		result->arithmetic_right = false;
+	} else if (GetFusedOperator(*expr.right, type, top_operator)) {
+		// the arithmetic is on the right side: flip the comparison
+		result->arithmetic_right = true;
+		comparison = FlipComparisonExpression(comparison);
+	} else {
+		return nullptr;
+	}
+	auto side = result->arithmetic_right ? 1 : 0;
+	auto &top = (result->arithmetic_right ? *expr.right : *expr.left).Cast<BoundFunctionExpression>();
+	auto &top_state = *state.child_states[side];
+
+	FusedOperator nested_operator;
+	bool has_nested = GetFusedOperator(*top.children[0], type, nested_operator);
+	if (!has_nested && top_operator != FusedOperator::SUBTRACT) {
+		// addition and multiplication are commutative: the nested operator can also be on the right
+		has_nested = GetFusedOperator(*top.children[1], type, nested_operator);
+		result->nested_right = has_nested;
+	}
+	if (has_nested) {
+		idx_t nested_idx = result->nested_right ? 1 : 0;
+		auto &nested = top.children[nested_idx]->Cast<BoundFunctionExpression>();
+		auto &nested_state = *top_state.child_states[nested_idx];
+		operators.push_back(nested_operator);
+		result->nodes.push_back(nested);
+		result->node_states.push_back(nested_state);
+		for (idx_t i = 0; i < 2; i++) {
+			result->leaves.push_back(*nested.children[i]);
+			result->leaf_states.push_back(*nested_state.child_states[i]);
+		}
+		result->leaves.push_back(*top.children[1 - nested_idx]);
+		result->leaf_states.push_back(*top_state.child_states[1 - nested_idx]);
+	} else {
+		for (idx_t i = 0; i < 2; i++) {
+			result->leaves.push_back(*top.children[i]);
+			result->leaf_states.push_back(*top_state.child_states[i]);
+		}
+	}
+	operators.push_back(top_operator);
+	result->nodes.push_back(top);
+	result->node_states.push_back(top_state);
+	// the other side of the comparison
+	result->leaves.push_back(result->arithmetic_right ? *expr.left : *expr.right);
+	result->leaf_states.push_back(*state.child_states[1 - side]);
+
+	result->kernel = GetFusedKernel(type.InternalType(), operators, comparison);
+	if (!result->kernel) {
+		return nullptr;
+	}
+	vector<LogicalType> leaf_types(result->leaves.size(), type);
+	result->leaf_chunk.Initialize(state.GetAllocator(), leaf_types);
+	result->inputs.resize(result->leaves.size());
+	result->true_sel.Initialize(STANDARD_VECTOR_SIZE);
+	return result;
+}
+
+bool ExpressionExecutor::ExecuteFusedLeaves(FusedComparison &fused, const SelectionVector *sel, idx_t count) {
+	fused.leaf_chunk.Reset();
+	bool can_fuse = true;
+	for (idx_t i = 0; i < fused.leaves.size(); i++) {
+		auto &leaf = fused.leaf_chunk.data[i];
+		Execute(fused.leaves[i].get(), &fused.leaf_states[i].get(), sel, count, leaf);
+		switch (leaf.GetVectorType()) {
+		case VectorType::CONSTANT_VECTOR:
+			can_fuse = can_fuse && !ConstantVector::IsNull(leaf);
+			fused.inputs[i].stride = 0;
+			break;
+		case VectorType::FLAT_VECTOR:
+			can_fuse = can_fuse && FlatVector::Validity(leaf).AllValid();
+			fused.inputs[i].stride = 1;
+			break;
+		default:
+			can_fuse = false;
+			break;
+		}
+		fused.inputs[i].data = leaf.GetData();
+	}
+	return can_fuse;
+}
+
+void ExpressionExecutor::ExecuteFusedChildren(FusedComparison &fused, idx_t count, Vector &left, Vector &right) {
+	auto &arithmetic = fused.arithmetic_right ? right : left;
+	auto &other = fused.arithmetic_right ? left : right;
+	auto &leaves = fused.leaf_chunk.data;
+	other.Reference(leaves.back());
+
+	auto execute_operator = [&](idx_t node_idx, Vector &lhs, Vector &rhs, Vector &result) {
+		auto &node = fused.nodes[node_idx].get();
+		DataChunk arguments;
+		arguments.InitializeEmpty({lhs.GetType(), rhs.GetType()});
+		arguments.data[0].Reference(lhs);
+		arguments.data[1].Reference(rhs);
+		arguments.SetCardinality(count);
+		node.function.function(arguments, fused.node_states[node_idx].get(), result);
+	};
+	if (fused.nodes.size() == 1) {
+		execute_operator(0, leaves[0], leaves[1], arithmetic);
+		return;
+	}
+	Vector nested(arithmetic.GetType());
+	execute_operator(0, leaves[0], leaves[1], nested);
+	if (fused.nested_right) {
+		execute_operator(1, leaves[2], nested, arithmetic);
+	} else {
+		execute_operator(1, nested, leaves[2], arithmetic);
+	}
+}
+
+} // namespace duckdb
@@ -107,6 +107,131 @@ public:
 		Vector addresses;
 	};
 
+	struct FramedAggregateState {
+		//	Fixed size
+		static constexpr idx_t MAX_BUFFER = 2048U;
+
+		static bool ComputeOffset(ClientContext &context, const unique_ptr<Expression> &expr, idx_t &offset) {
+			if (!expr || expr->HasParameter() || !expr->IsFoldable()) {
+				return false;
+			}
+			auto offset_value = ExpressionExecutor::EvaluateScalar(context, *expr);
+			if (offset_value.IsNull()) {
+				return false;
+			}
+			Value bigint_value;
+			if (!offset_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+				return false;
+			}
+			const auto value = bigint_value.GetValue<int64_t>();
+			//	We can only buffer a limited number of rows
+			if (value < 0 || idx_t(value) >= MAX_BUFFER) {
+				return false;
+			}
+			offset = idx_t(value);
+			return true;
+		}
+
+		static bool ComputeFrame(ClientContext &context, BoundWindowExpression &wexpr, idx_t &start, idx_t &end) {
+			//	We can stream frames that end a constant number of rows before the current row
+			if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS) {
+				return false;
+			}
+			if (!ComputeOffset(context, wexpr.start_expr, start)) {
+				return false;
+			}
+			switch (wexpr.end) {
+			case WindowBoundary::CURRENT_ROW_ROWS:
+				end = 0;
+				return true;
+			case WindowBoundary::EXPR_PRECEDING_ROWS:
+				return ComputeOffset(context, wexpr.end_expr, end);
+			default:
+				return false;
+			}
+		}
+
+		FramedAggregateState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator)
+		    : wexpr(wexpr), aggregate(*wexpr.aggregate), arena_allocator(Allocator::DefaultAllocator()),
+		      executor(client), state_size(aggregate.state_size(aggregate)), statep(LogicalType::POINTER),
+		      statef(LogicalType::POINTER) {
+			D_ASSERT(wexpr.GetExpressionType() == ExpressionType::WINDOW_AGGREGATE);
+			ComputeFrame(client, wexpr, start, end);
+
+			//	The FILTER is evaluated into an extra BOOLEAN column after the arguments
+			vector<LogicalType> frame_types;
+			for (auto &child : wexpr.children) {
+				arg_types.push_back(child->return_type);
+				frame_types.push_back(child->return_type);
+				executor.AddExpression(*child);
+			}
+			if (wexpr.filter_expr) {
+				frame_types.push_back(LogicalType::BOOLEAN);
+				executor.AddExpression(*wexpr.filter_expr);
+			}
+			if (!frame_types.empty()) {
+				arg_chunk.Initialize(allocator, frame_types);
+				frame.Initialize(allocator, frame_types, start + STANDARD_VECTOR_SIZE);
+				prev.Initialize(allocator, frame_types, MaxValue<idx_t>(start, 1));
+			}
+			if (!arg_types.empty()) {
+				leaves.InitializeEmpty(arg_types);
+			}
+			sel.Initialize();
+
+			//	Build the finalise vector that just points to the result states
+			states.resize(state_size * STANDARD_VECTOR_SIZE);
+			auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+			for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+				fdata[i] = states.data() + i * state_size;
+			}
+		}
+
+		inline bool RowPassesFilter(idx_t row) const {
+			if (!wexpr.filter_expr) {
+				return true;
+			}
+			auto &filter = frame.data[arg_types.size()];
+			return FlatVector::Validity(filter).RowIsValid(row) && FlatVector::GetData<bool>(filter)[row];
+		}
+
+		void Execute(ExecutionContext &context, DataChunk &input, Vector &result);
+
+		//! The aggregate expression
+		BoundWindowExpression &wexpr;
+		//! The aggregate function
+		AggregateFunction &aggregate;
+		//! The allocator to use for aggregate data structures
+		ArenaAllocator arena_allocator;
+		//! Reusable executor for the children and the FILTER
+		ExpressionExecutor executor;
+		//! The frame is [row - start, row - end]
+		idx_t start = 0;
+		idx_t end = 0;
+		//! The size of a single aggregate state
+		const idx_t state_size;
+		//! The aggregate states for one output chunk
+		vector<data_t> states;
+		//! The states to update
+		Vector statep;
+		//! The states to finalise
+		Vector statef;
+		//! Argument types
+		vector<LogicalType> arg_types;
+		//! The arguments (and FILTER) of the current chunk
+		DataChunk arg_chunk;
+		//! The buffered rows followed by the current chunk
+		DataChunk frame;
+		//! The rows we need to keep for the next chunk
+		DataChunk prev;
+		//! The number of rows buffered from previous chunks
+		idx_t buffered = 0;
+		//! The frame rows passed to the update
+		DataChunk leaves;
+		//! The frame rows to update with
+		SelectionVector sel;
+	};
+
 	struct LeadLagState {
 		//	Fixed size
 		static constexpr idx_t MAX_BUFFER = 2048U;
@@ -263,6 +388,7 @@ public:
 	void Initialize(ClientContext &context, DataChunk &input, const vector<unique_ptr<Expression>> &expressions) {
 		const_vectors.resize(expressions.size());
 		aggregate_states.resize(expressions.size());
+		framed_states.resize(expressions.size());
 		lead_lag_states.resize(expressions.size());
 
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
@@ -270,7 +396,11 @@ public:
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
 			switch (expr.GetExpressionType()) {
 			case ExpressionType::WINDOW_AGGREGATE:
-				aggregate_states[expr_idx] = make_uniq<AggregateState>(context, wexpr, allocator);
+				if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+					aggregate_states[expr_idx] = make_uniq<AggregateState>(context, wexpr, allocator);
+				} else {
+					framed_states[expr_idx] = make_uniq<FramedAggregateState>(context, wexpr, allocator);
+				}
 				break;
 			case ExpressionType::WINDOW_FIRST_VALUE: {
 				// Just execute the expression once
@@ -319,6 +449,8 @@ public:
 	vector<unique_ptr<Vector>> const_vectors;
 	//! Aggregation states
 	vector<unique_ptr<AggregateState>> aggregate_states;
+	//! Framed aggregation states
+	vector<unique_ptr<FramedAggregateState>> framed_states;
 	Allocator &allocator;
 	//! Lead/Lag states
 	vector<unique_ptr<LeadLagState>> lead_lag_states;
@@ -338,9 +470,16 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 	}
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
+	case ExpressionType::WINDOW_AGGREGATE: {
 		// We can stream aggregates if they are "running totals"
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+			return true;
+		}
+		// or if they only need a bounded number of preceding rows
+		idx_t start;
+		idx_t end;
+		return !wexpr.distinct && StreamingWindowState::FramedAggregateState::ComputeFrame(context, wexpr, start, end);
+	}
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -470,6 +609,85 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	}
 }
 
+void StreamingWindowState::FramedAggregateState::Execute(ExecutionContext &context, DataChunk &input,
+                                                       Vector &result) {
+	const idx_t count = input.size();
+
+	//	Stack the new arguments under the buffered rows
+	if (frame.ColumnCount()) {
+		arg_chunk.Reset();
+		executor.Execute(input, arg_chunk);
+		arg_chunk.Flatten();
+
+		//	Reset() shrinks the capacity back to STANDARD_VECTOR_SIZE, so allow the appends to resize
+		frame.Reset();
+		frame.Append(prev, true);
+		frame.Append(arg_chunk, true);
+	}
+
+	//	Row i of the input is at position buffered + i in the frame buffer
+	if (wexpr.children.empty()) {
+		// COUNT(*)
+		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
+		auto rdata = FlatVector::GetData<int64_t>(result);
+		for (idx_t i = 0; i < count; ++i) {
+			const auto pos = buffered + i;
+			const auto begin = pos > start ? pos - start : 0;
+			const auto end_pos = pos + 1 > end ? pos + 1 - end : 0;
+			int64_t counted = 0;
+			for (auto row = begin; row < end_pos; ++row) {
+				counted += int64_t(RowPassesFilter(row));
+			}
+			rdata[i] = counted;
+		}
+	} else {
+		AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+		for (idx_t i = 0; i < count; ++i) {
+			aggregate.initialize(aggregate, states.data() + i * state_size);
+		}
+
+		//	Update the states one frame offset at a time, starting with the oldest row
+		auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+		for (auto delta = start + 1; delta-- > end;) {
+			idx_t updated = 0;
+			for (idx_t i = 0; i < count; ++i) {
+				const auto pos = buffered + i;
+				if (pos < delta) {
+					continue;
+				}
+				const auto row = pos - delta;
+				if (!RowPassesFilter(row)) {
+					continue;
+				}
+				sel.set_index(updated, row);
+				pdata[updated++] = states.data() + i * state_size;
+			}
+			if (!updated) {
+				continue;
+			}
+			for (idx_t col_idx = 0; col_idx < leaves.ColumnCount(); ++col_idx) {
+				leaves.data[col_idx].Slice(frame.data[col_idx], sel, updated);
+			}
+			aggregate.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statep, updated);
+		}
+
+		aggregate.finalize(statef, aggr_input_data, result, count, 0);
+		if (aggregate.destructor) {
+			aggregate.destructor(statef, aggr_input_data, count);
+		}
+		arena_allocator.Reset();
+	}
+
+	//	Keep the rows that later frames can still reach
+	const auto total = buffered + count;
+	const auto keep = MinValue<idx_t>(start, total);
+	if (frame.ColumnCount()) {
+		prev.Reset();
+		frame.Copy(prev, total - keep);
+	}
+	buffered = keep;
+}
+
 void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataChunk &chunk, DataChunk &delayed,
                                                GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
@@ -484,7 +702,11 @@ void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataCh
 		auto &result = chunk.data[col_idx];
 		switch (expr.GetExpressionType()) {
 		case ExpressionType::WINDOW_AGGREGATE:
-			state.aggregate_states[expr_idx]->Execute(context, chunk, result);
+			if (state.aggregate_states[expr_idx]) {
+				state.aggregate_states[expr_idx]->Execute(context, chunk, result);
+			} else {
+				state.framed_states[expr_idx]->Execute(context, chunk, result);
+			}
 			break;
 		case ExpressionType::WINDOW_FIRST_VALUE:
 		case ExpressionType::WINDOW_PERCENT_RANK:
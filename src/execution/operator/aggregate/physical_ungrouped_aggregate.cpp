@@ -16,6 +16,7 @@
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
+#include "duckdb/storage/table/statistics_aggregate.hpp"
 
 #include <functional>
 
@@ -142,6 +143,50 @@ void GlobalUngroupedAggregateState::CombineDistinct(LocalUngroupedAggregateState
 	}
 }
 
+void GlobalUngroupedAggregateState::CombineStatistics(StatisticsAggregateState &statistics) {
+	D_ASSERT(statistics.aggregates.size() == state.aggregate_expressions.size());
+	lock_guard<mutex> glock(lock);
+	for (idx_t aggr_idx = 0; aggr_idx < state.aggregate_expressions.size(); aggr_idx++) {
+		auto &aggregate = state.aggregate_expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto &statistics_aggregate = statistics.aggregates[aggr_idx];
+		auto result = statistics.GetResult(aggr_idx);
+		if (result.IsNull()) {
+			continue;
+		}
+		AggregateInputData aggr_input_data(state.bind_data[aggr_idx], allocator);
+		idx_t count;
+		switch (statistics_aggregate.type) {
+		case StatisticsAggregateType::COUNT_STAR:
+			count = result.GetValue<uint64_t>();
+			if (count > 0) {
+				aggregate.function.simple_update(nullptr, aggr_input_data, 0, state.aggregate_data[aggr_idx].get(),
+				                                 count);
+			}
+			break;
+		case StatisticsAggregateType::COUNT: {
+			count = result.GetValue<uint64_t>();
+			if (count > 0) {
+				// count only looks at the validity of its input: feed it a non-NULL constant
+				Vector input(statistics_aggregate.column_type);
+				input.SetVectorType(VectorType::CONSTANT_VECTOR);
+				aggregate.function.simple_update(&input, aggr_input_data, 1, state.aggregate_data[aggr_idx].get(),
+				                                 count);
+			}
+			break;
+		}
+		default: {
+			count = 1;
+			Vector input(result);
+			aggregate.function.simple_update(&input, aggr_input_data, 1, state.aggregate_data[aggr_idx].get(), count);
+			break;
+		}
+		}
+#ifdef DEBUG
+		state.counts[aggr_idx] += count;
+#endif
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Local State
 //===--------------------------------------------------------------------===//
@@ -602,6 +647,9 @@ SinkFinalizeType PhysicalUngroupedAggregate::Finalize(Pipeline &pipeline, Event
 	}
 
 	D_ASSERT(!gstate.finished);
+	if (statistics_aggregates) {
+		gstate.state.CombineStatistics(*statistics_aggregates);
+	}
 	gstate.finished = true;
 	return SinkFinalizeType::READY;
 }
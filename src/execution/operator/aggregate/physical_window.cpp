@@ -4,6 +4,7 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
@@ -145,6 +146,8 @@ public:
 	unique_ptr<WindowPartitionGlobalSinkState> global_partition;
 	//! The execution functions
 	Executors executors;
+	//! An earlier executor whose built data each executor reuses (if any)
+	vector<optional_idx> shared_executors;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
@@ -257,6 +260,19 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto wexec = WindowExecutorFactory(wexpr, context, mode);
+
+		//	Reuse the data (e.g., the aggregate trees) built by an equivalent executor
+		optional_idx shared;
+		if (!wexpr.IsVolatile()) {
+			for (idx_t w = 0; w < executors.size(); ++w) {
+				if (!shared_executors[w].IsValid() && wexec->CanShare(*executors[w])) {
+					shared = w;
+					break;
+				}
+			}
+		}
+
+		shared_executors.emplace_back(shared);
 		executors.emplace_back(std::move(wexec));
 	}
 
@@ -594,10 +610,18 @@ WindowHashGroup::ExecutorGlobalStates &WindowHashGroup::Initialize(WindowGlobalS
 	}
 
 	// These can be large so we defer building them until we are ready.
-	for (auto &wexec : executors) {
+	const auto &shared_executors = gsink.shared_executors;
+	for (idx_t w = 0; w < executors.size(); ++w) {
+		auto &wexec = executors[w];
 		auto &wexpr = wexec->wexpr;
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
-		gestates.emplace_back(wexec->GetGlobalState(count, partition_mask, order_mask));
+		const auto &shared = shared_executors[w];
+		if (shared.IsValid()) {
+			auto &gshared = *gestates[shared.GetIndex()];
+			gestates.emplace_back(wexec->GetSharedGlobalState(gshared, count, partition_mask, order_mask));
+		} else {
+			gestates.emplace_back(wexec->GetGlobalState(count, partition_mask, order_mask));
+		}
 	}
 
 	return gestates;
@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -21,6 +22,37 @@ PhysicalTopN::PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> o
 //===--------------------------------------------------------------------===//
 class TopNHeap;
 
+//! The boundary value shared between the heaps of all threads - rows that do not beat it can be skipped by every heap
+class TopNBoundaryValue {
+public:
+	explicit TopNBoundaryValue(const PhysicalTopN &op);
+
+	const PhysicalTopN &op;
+	//! Whether or not the boundary value is shared between threads
+	bool enabled;
+	//! The dynamic filter that receives the boundary of the first order (if any)
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	idx_t GetVersion() const {
+		return version.load();
+	}
+	//! Publish a new local boundary. Returns true if the shared boundary is tighter, in which case it is copied into
+	//! the local boundary instead
+	bool Update(vector<Value> &local_values, idx_t &local_version);
+	//! Fetch the shared boundary
+	void GetValues(vector<Value> &local_values, idx_t &local_version);
+
+private:
+	mutex lock;
+	vector<Value> boundary_values;
+	atomic<idx_t> version;
+
+private:
+	//! Whether or not the left boundary precedes the right boundary in the sort order
+	bool IsTighter(const vector<Value> &left, const vector<Value> &right) const;
+};
+
 struct TopNScanState {
 	unique_ptr<PayloadScanner> scanner;
 	idx_t pos;
@@ -75,6 +107,10 @@ public:
 	DataChunk boundary_values;
 	//! Whether or not the boundary_values has been set. The boundary_values are only set after a reduce step
 	bool has_boundary_values;
+	//! The boundary value shared with the other heaps (if any)
+	optional_ptr<TopNBoundaryValue> shared_boundary;
+	//! The version of the shared boundary value the boundary_values were last synchronized with
+	idx_t shared_boundary_version = 0;
 
 	SelectionVector final_sel;
 	SelectionVector true_sel;
@@ -88,6 +124,9 @@ public:
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
+	//! Exchange the local boundary values with the shared boundary value
+	void SyncBoundaryValues();
+	void SetBoundaryValues(const vector<Value> &values);
 
 	void InitializeScan(TopNScanState &state, bool exclude_offset);
 	void Scan(TopNScanState &state, DataChunk &chunk);
@@ -252,6 +291,12 @@ TopNHeap::TopNHeap(ExecutionContext &context, const vector<LogicalType> &payload
 }
 
 void TopNHeap::Sink(DataChunk &input) {
+	if (shared_boundary && shared_boundary->GetVersion() != shared_boundary_version) {
+		// another thread has found a tighter boundary - use it to filter the input
+		vector<Value> values;
+		shared_boundary->GetValues(values, shared_boundary_version);
+		SetBoundaryValues(values);
+	}
 	sort_state.Sink(input);
 }
 
@@ -326,6 +371,34 @@ void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_c
 		boundary_values.data[i].SetVectorType(VectorType::CONSTANT_VECTOR);
 	}
 	has_boundary_values = true;
+	SyncBoundaryValues();
+}
+
+void TopNHeap::SyncBoundaryValues() {
+	if (!shared_boundary) {
+		return;
+	}
+	D_ASSERT(has_boundary_values);
+	vector<Value> values;
+	for (idx_t i = 0; i < boundary_values.ColumnCount(); i++) {
+		values.push_back(boundary_values.GetValue(i, 0));
+	}
+	if (shared_boundary->Update(values, shared_boundary_version)) {
+		SetBoundaryValues(values);
+	}
+}
+
+void TopNHeap::SetBoundaryValues(const vector<Value> &values) {
+	D_ASSERT(values.size() == boundary_values.ColumnCount());
+	boundary_values.Reset();
+	for (idx_t i = 0; i < values.size(); i++) {
+		boundary_values.data[i].SetValue(0, values[i]);
+	}
+	boundary_values.SetCardinality(1);
+	for (idx_t i = 0; i < boundary_values.ColumnCount(); i++) {
+		boundary_values.data[i].SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+	has_boundary_values = true;
 }
 
 bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
@@ -398,15 +471,84 @@ void TopNHeap::Scan(TopNScanState &state, DataChunk &chunk) {
 	sort_state.Scan(state, chunk);
 }
 
+//===--------------------------------------------------------------------===//
+// TopNBoundaryValue
+//===--------------------------------------------------------------------===//
+TopNBoundaryValue::TopNBoundaryValue(const PhysicalTopN &op) : op(op), enabled(true), version(0) {
+	for (auto &order : op.orders) {
+		if (order.expression->return_type.IsNested()) {
+			enabled = false;
+		}
+	}
+	if (enabled && op.dynamic_filters) {
+		filter_data = make_shared_ptr<DynamicFilterData>();
+	}
+}
+
+bool TopNBoundaryValue::IsTighter(const vector<Value> &left, const vector<Value> &right) const {
+	D_ASSERT(left.size() == op.orders.size() && right.size() == op.orders.size());
+	for (idx_t i = 0; i < op.orders.size(); i++) {
+		auto &order = op.orders[i];
+		auto &lvalue = left[i];
+		auto &rvalue = right[i];
+		if (lvalue.IsNull() || rvalue.IsNull()) {
+			if (lvalue.IsNull() && rvalue.IsNull()) {
+				continue;
+			}
+			return lvalue.IsNull() == (order.null_order == OrderByNullType::NULLS_FIRST);
+		}
+		if (lvalue == rvalue) {
+			continue;
+		}
+		return order.type == OrderType::ASCENDING ? lvalue < rvalue : rvalue < lvalue;
+	}
+	return false;
+}
+
+bool TopNBoundaryValue::Update(vector<Value> &local_values, idx_t &local_version) {
+	lock_guard<mutex> guard(lock);
+	if (boundary_values.empty() || IsTighter(local_values, boundary_values)) {
+		// the local boundary is tighter - publish it
+		boundary_values = local_values;
+		local_version = ++version;
+		if (filter_data) {
+			// only the first order can be pushed into the scan
+			auto &first_value = boundary_values[0];
+			if (!first_value.IsNull()) {
+				auto comparison_type = op.orders[0].type == OrderType::ASCENDING
+				                           ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+				                           : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+				filter_data->SetValue(comparison_type, first_value);
+			}
+		}
+		return false;
+	}
+	local_version = version;
+	if (!IsTighter(boundary_values, local_values)) {
+		return false;
+	}
+	local_values = boundary_values;
+	return true;
+}
+
+void TopNBoundaryValue::GetValues(vector<Value> &local_values, idx_t &local_version) {
+	lock_guard<mutex> guard(lock);
+	local_values = boundary_values;
+	local_version = version;
+}
+
+//===--------------------------------------------------------------------===//
+// Sink State
+//===--------------------------------------------------------------------===//
 class TopNGlobalState : public GlobalSinkState {
 public:
-	TopNGlobalState(ClientContext &context, const vector<LogicalType> &payload_types,
-	                const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNGlobalState(ClientContext &context, const PhysicalTopN &op)
+	    : heap(context, op.types, op.orders, op.limit, op.offset), boundary_value(op) {
 	}
 
 	mutex lock;
 	TopNHeap heap;
+	TopNBoundaryValue boundary_value;
 };
 
 class TopNLocalState : public LocalSinkState {
@@ -420,11 +562,25 @@ public:
 };
 
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) const {
-	return make_uniq<TopNLocalState>(context, types, orders, limit, offset);
+	auto &gstate = sink_state->Cast<TopNGlobalState>();
+	auto result = make_uniq<TopNLocalState>(context, types, orders, limit, offset);
+	if (gstate.boundary_value.enabled) {
+		result->heap.shared_boundary = gstate.boundary_value;
+	}
+	return std::move(result);
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	auto result = make_uniq<TopNGlobalState>(context, *this);
+	if (dynamic_filters) {
+		// push the (not yet set) boundary value into the scan
+		dynamic_filters->ClearFilters(*this);
+		if (result->boundary_value.filter_data) {
+			auto filter = make_uniq<DynamicFilter>(result->boundary_value.filter_data);
+			dynamic_filters->PushFilter(*this, dynamic_filter_column, std::move(filter));
+		}
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
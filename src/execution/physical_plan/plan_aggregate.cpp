@@ -4,13 +4,17 @@
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/storage/table/statistics_aggregate.hpp"
 
 namespace duckdb {
 
@@ -149,6 +153,83 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool GetStatisticsAggregateType(BoundAggregateExpression &aggr, StatisticsAggregateType &result) {
+	auto &name = aggr.function.name;
+	if (name == "count_star" || (name == "count" && aggr.children.empty())) {
+		result = StatisticsAggregateType::COUNT_STAR;
+	} else if (name == "count") {
+		result = StatisticsAggregateType::COUNT;
+	} else if (name == "min") {
+		result = StatisticsAggregateType::MIN;
+	} else if (name == "max") {
+		result = StatisticsAggregateType::MAX;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+//! Ungrouped MIN/MAX/COUNT aggregates directly over a sequential table scan are pushed into the scan - the scan
+//! answers row groups that entirely pass its filters from their statistics, and only scans the remaining row groups
+static void PushAggregatesIntoScan(PhysicalUngroupedAggregate &aggregate, PhysicalOperator &child) {
+	// look through a projection that only references columns of the scan
+	optional_ptr<PhysicalProjection> projection;
+	auto scan_op = &child;
+	if (child.type == PhysicalOperatorType::PROJECTION) {
+		projection = child.Cast<PhysicalProjection>();
+		scan_op = child.children[0].get();
+	}
+	if (scan_op->type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	auto &scan = scan_op->Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return;
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return;
+	}
+	vector<StatisticsAggregate> statistics_aggregates;
+	for (auto &expr : aggregate.aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		StatisticsAggregateType type;
+		if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || !GetStatisticsAggregateType(aggr, type)) {
+			return;
+		}
+		if (type == StatisticsAggregateType::COUNT_STAR) {
+			statistics_aggregates.emplace_back(type, DConstants::INVALID_INDEX, LogicalType::BIGINT);
+			continue;
+		}
+		if (aggr.children.size() != 1 || aggr.children[0]->type != ExpressionType::BOUND_REF) {
+			return;
+		}
+		auto scan_index = aggr.children[0]->Cast<BoundReferenceExpression>().index;
+		if (projection) {
+			auto &projected = projection->select_list[scan_index];
+			if (projected->type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			scan_index = projected->Cast<BoundReferenceExpression>().index;
+		}
+		if (!scan.projection_ids.empty()) {
+			scan_index = scan.projection_ids[scan_index];
+		}
+		auto column_id = scan.column_ids[scan_index];
+		if (IsRowIdColumnId(column_id)) {
+			return;
+		}
+		auto &column = bind_data.table.GetColumn(LogicalIndex(column_id));
+		if (column.Generated() || !StatisticsAggregate::SupportsType(type, column.Type())) {
+			return;
+		}
+		statistics_aggregates.emplace_back(type, column.StorageOid(), column.Type());
+	}
+	auto state = make_shared_ptr<StatisticsAggregateState>(std::move(statistics_aggregates));
+	bind_data.statistics_aggregates = state;
+	aggregate.statistics_aggregates = std::move(state);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -170,8 +251,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			}
 		}
 		if (use_simple_aggregation) {
-			groupby = make_uniq_base<PhysicalOperator, PhysicalUngroupedAggregate>(op.types, std::move(op.expressions),
-			                                                                       op.estimated_cardinality);
+			auto ungrouped_aggregate =
+			    make_uniq<PhysicalUngroupedAggregate>(op.types, std::move(op.expressions), op.estimated_cardinality);
+			PushAggregatesIntoScan(*ungrouped_aggregate, *plan);
+			groupby = std::move(ungrouped_aggregate);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), op.estimated_cardinality);
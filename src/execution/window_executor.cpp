@@ -912,6 +912,13 @@ unique_ptr<WindowExecutorLocalState> WindowExecutor::GetLocalState(const WindowE
 	return make_uniq<WindowExecutorBoundsState>(gstate);
 }
 
+unique_ptr<WindowExecutorGlobalState> WindowExecutor::GetSharedGlobalState(WindowExecutorGlobalState &shared,
+                                                                           const idx_t payload_count,
+                                                                           const ValidityMask &partition_mask,
+                                                                           const ValidityMask &order_mask) const {
+	throw InternalException("Window executor cannot share its global state");
+}
+
 void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count,
                           WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const {
 	lstate.Sink(gstate, input_chunk, input_idx);
@@ -922,22 +929,30 @@ void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const i
 //===--------------------------------------------------------------------===//
 class WindowAggregateExecutorGlobalState : public WindowExecutorGlobalState {
 public:
-	bool IsConstantAggregate();
-	bool IsCustomAggregate();
-	bool IsDistinctAggregate();
-
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
-	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
+	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask,
+	                                   optional_ptr<WindowAggregateExecutorGlobalState> shared = nullptr);
+
+	//! Is the aggregate data built by another executor?
+	bool IsShared() const {
+		return shared.get() != nullptr;
+	}
+	WindowAggregator &GetAggregator() const {
+		return shared ? shared->GetAggregator() : *aggregator;
+	}
+	WindowAggregatorState &GetSink() const {
+		return shared ? shared->GetSink() : *gsink;
+	}
 
 	// aggregate computation algorithm
 	unique_ptr<WindowAggregator> aggregator;
 	// aggregate global state
 	unique_ptr<WindowAggregatorState> gsink;
+	// the global state of an executor whose aggregate data we reuse
+	optional_ptr<WindowAggregateExecutorGlobalState> shared;
 };
 
-bool WindowAggregateExecutorGlobalState::IsConstantAggregate() {
-	const auto &wexpr = executor.wexpr;
-
+static bool IsConstantAggregate(const BoundWindowExpression &wexpr) {
 	if (!wexpr.aggregate) {
 		return false;
 	}
@@ -995,9 +1010,7 @@ bool WindowAggregateExecutorGlobalState::IsConstantAggregate() {
 	return true;
 }
 
-bool WindowAggregateExecutorGlobalState::IsDistinctAggregate() {
-	const auto &wexpr = executor.wexpr;
-
+static bool IsDistinctAggregate(const BoundWindowExpression &wexpr) {
 	if (!wexpr.aggregate) {
 		return false;
 	}
@@ -1005,10 +1018,7 @@ bool WindowAggregateExecutorGlobalState::IsDistinctAggregate() {
 	return wexpr.distinct;
 }
 
-bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
-	const auto &wexpr = executor.wexpr;
-	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
-
+static bool IsCustomAggregate(const BoundWindowExpression &wexpr, const WindowAggregationMode mode) {
 	if (!wexpr.aggregate) {
 		return false;
 	}
@@ -1036,11 +1046,46 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
     : WindowExecutor(wexpr, context), mode(mode) {
 }
 
-WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor,
-                                                                       const idx_t group_count,
-                                                                       const ValidityMask &partition_mask,
-                                                                       const ValidityMask &order_mask)
-    : WindowExecutorGlobalState(executor, group_count, partition_mask, order_mask) {
+bool WindowAggregateExecutor::CanShare(const WindowExecutor &other_p) const {
+	//	The segment tree and the distinct merge sort tree only depend on the aggregate input,
+	//	so aggregates that differ only in their framing can evaluate against the same tree.
+	if (other_p.wexpr.type != ExpressionType::WINDOW_AGGREGATE) {
+		return false;
+	}
+	auto &other = reinterpret_cast<const WindowAggregateExecutor &>(other_p);
+	if (mode != other.mode || !wexpr.aggregate || !other.wexpr.aggregate) {
+		return false;
+	}
+	//	Constant aggregates depend on the frame and custom aggregates on the frame statistics
+	if (IsConstantAggregate(wexpr) || IsConstantAggregate(other.wexpr) || IsCustomAggregate(wexpr, mode)) {
+		return false;
+	}
+	if (wexpr.distinct != other.wexpr.distinct || wexpr.exclude_clause != other.wexpr.exclude_clause) {
+		return false;
+	}
+	if (*wexpr.aggregate != *other.wexpr.aggregate) {
+		return false;
+	}
+	if (wexpr.bind_info.get() != other.wexpr.bind_info.get()) {
+		if (!wexpr.bind_info || !other.wexpr.bind_info || !wexpr.bind_info->Equals(*other.wexpr.bind_info)) {
+			return false;
+		}
+	}
+	if (!Expression::ListEquals(wexpr.children, other.wexpr.children) ||
+	    !Expression::Equals(wexpr.filter_expr, other.wexpr.filter_expr)) {
+		return false;
+	}
+	return wexpr.KeysAreCompatible(other.wexpr);
+}
+
+WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(
+    const WindowAggregateExecutor &executor, const idx_t group_count, const ValidityMask &partition_mask,
+    const ValidityMask &order_mask, optional_ptr<WindowAggregateExecutorGlobalState> shared)
+    : WindowExecutorGlobalState(executor, group_count, partition_mask, order_mask), shared(shared) {
+	if (shared) {
+		return;
+	}
+
 	auto &wexpr = executor.wexpr;
 	auto &context = executor.context;
 	auto return_type = wexpr.return_type;
@@ -1052,13 +1097,13 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 	AggregateObject aggr(wexpr);
 	if (force_naive || (wexpr.distinct && wexpr.exclude_clause != WindowExcludeMode::NO_OTHER)) {
 		aggregator = make_uniq<WindowNaiveAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
-	} else if (IsDistinctAggregate()) {
+	} else if (IsDistinctAggregate(wexpr)) {
 		// build a merge sort tree
 		// see https://dl.acm.org/doi/pdf/10.1145/3514221.3526184
 		aggregator = make_uniq<WindowDistinctAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause, context);
-	} else if (IsConstantAggregate()) {
+	} else if (IsConstantAggregate(wexpr)) {
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
-	} else if (IsCustomAggregate()) {
+	} else if (IsCustomAggregate(wexpr, mode)) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
@@ -1075,13 +1120,25 @@ unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(co
 	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask);
 }
 
+unique_ptr<WindowExecutorGlobalState>
+WindowAggregateExecutor::GetSharedGlobalState(WindowExecutorGlobalState &shared, const idx_t payload_count,
+                                              const ValidityMask &partition_mask,
+                                              const ValidityMask &order_mask) const {
+	auto &gshared = shared.Cast<WindowAggregateExecutorGlobalState>();
+	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask, &gshared);
+}
+
 class WindowAggregateExecutorLocalState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateExecutorLocalState(const WindowExecutorGlobalState &gstate, const WindowAggregator &aggregator)
 	    : WindowExecutorBoundsState(gstate), filter_executor(gstate.executor.context) {
 
+		//	Shared aggregates do not participate in the build,
+		//	so we defer creating their state until evaluation.
 		auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
-		aggregator_state = aggregator.GetLocalState(*gastate.gsink);
+		if (!gastate.IsShared()) {
+			aggregator_state = aggregator.GetLocalState(gastate.GetSink());
+		}
 
 		// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
 		auto &wexpr = gstate.executor.wexpr;
@@ -1103,13 +1160,19 @@ public:
 unique_ptr<WindowExecutorLocalState>
 WindowAggregateExecutor::GetLocalState(const WindowExecutorGlobalState &gstate) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
-	auto res = make_uniq<WindowAggregateExecutorLocalState>(gstate, *gastate.aggregator);
+	auto res = make_uniq<WindowAggregateExecutorLocalState>(gstate, gastate.GetAggregator());
 	return std::move(res);
 }
 
 void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count,
                                    WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
+	if (gastate.IsShared()) {
+		//	The aggregate data is built by the executor we are sharing with
+		WindowExecutor::Sink(input_chunk, input_idx, total_count, gstate, lstate);
+		return;
+	}
+
 	auto &lastate = lstate.Cast<WindowAggregateExecutorLocalState>();
 	auto &filter_sel = lastate.filter_sel;
 	auto &filter_executor = lastate.filter_executor;
@@ -1201,6 +1264,9 @@ static void ApplyWindowStats(const WindowBoundary &boundary, FrameDelta &delta,
 
 void WindowAggregateExecutor::Finalize(WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
+	if (gastate.IsShared()) {
+		return;
+	}
 	auto &aggregator = gastate.aggregator;
 	auto &gsink = gastate.gsink;
 	D_ASSERT(aggregator);
@@ -1228,13 +1294,15 @@ void WindowAggregateExecutor::EvaluateInternal(WindowExecutorGlobalState &gstate
                                                Vector &result, idx_t count, idx_t row_idx) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
 	auto &lastate = lstate.Cast<WindowAggregateExecutorLocalState>();
-	auto &aggregator = gastate.aggregator;
-	auto &gsink = gastate.gsink;
-	D_ASSERT(aggregator);
+	auto &aggregator = gastate.GetAggregator();
+	auto &gsink = gastate.GetSink();
 
+	if (!lastate.aggregator_state) {
+		lastate.aggregator_state = aggregator.GetLocalState(gsink);
+	}
 	auto &agg_state = *lastate.aggregator_state;
 
-	aggregator->Evaluate(*gsink, agg_state, lastate.bounds, result, count, row_idx);
+	aggregator.Evaluate(gsink, agg_state, lastate.bounds, result, count, row_idx);
 }
 
 //===--------------------------------------------------------------------===//
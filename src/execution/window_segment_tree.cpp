@@ -52,6 +52,17 @@ public:
 
 	//! Number of finalised states
 	std::atomic<idx_t> finalized;
+
+	ArenaAllocator &CreateTreeAllocator() {
+		lock_guard<mutex> tree_lock(lock);
+		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
+		return *tree_allocators.back();
+	}
+
+	//! The tree allocators.
+	//! We need to hold onto them for the tree lifetime,
+	//! not the lifetime of the local state that constructed part of the tree
+	vector<unique_ptr<ArenaAllocator>> tree_allocators;
 };
 
 WindowAggregator::WindowAggregator(AggregateObject aggr_p, const vector<LogicalType> &arg_types_p,
@@ -829,12 +840,6 @@ public:
 
 	WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count);
 
-	ArenaAllocator &CreateTreeAllocator() {
-		lock_guard<mutex> tree_lock(lock);
-		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
-		return *tree_allocators.back();
-	}
-
 	//! The owning aggregator
 	const WindowSegmentTree &tree;
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
@@ -847,10 +852,6 @@ public:
 	unique_ptr<AtomicCounters> build_started;
 	//! The number of entries completed so far at each level
 	unique_ptr<AtomicCounters> build_completed;
-	//! The tree allocators.
-	//! We need to hold onto them for the tree lifetime,
-	//! not the lifetime of the local state that constructed part of the tree
-	vector<unique_ptr<ArenaAllocator>> tree_allocators;
 
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
@@ -1719,15 +1720,48 @@ void WindowDistinctAggregator::Finalize(WindowAggregatorState &gsink, WindowAggr
 		}
 	}
 
-	//	Last one out turns off the lights!
-	if (++gdsink.finalized == gdsink.locals) {
-		gdsink.Finalize(stats);
-	}
+	//	Build the tree in parallel
+	gdsink.Finalize(stats);
 }
 
 class WindowDistinctAggregatorGlobalState::DistinctSortTree : public MergeSortTree<idx_t, idx_t> {
 public:
 	DistinctSortTree(ZippedElements &&prev_idcs, WindowDistinctAggregatorGlobalState &gdsink);
+
+	//! Build the zipped tree and then the level aggregates. This can be called from multiple threads.
+	void Build();
+
+protected:
+	//! The width of the aggregation tasks for a level
+	static idx_t TaskWidth(idx_t level_nr) {
+		//	Tasks are whole runs so the running aggregates don't cross them
+		const auto run_length = RunLength(level_nr);
+		return run_length * MaxValue<idx_t>(1, STANDARD_VECTOR_SIZE / run_length);
+	}
+
+	//! Compute the running aggregates for the runs in [begin, end) of a level
+	void BuildRuns(idx_t level_nr, idx_t begin, idx_t end, ArenaAllocator &allocator);
+
+	//! Release the zipped tree once the last thread has left Build
+	void ReleaseZippedTree();
+
+	WindowDistinctAggregatorGlobalState &gdsink;
+	//! The number of elements in each level
+	const idx_t count;
+	//! The (prev_idx, input_idx) tree that the levels are taken from
+	MergeSortTree<ZippedTuple> zipped_tree;
+	//! The first aggregation task of each level, plus the total
+	vector<idx_t> level_tasks;
+	//! The number of aggregation tasks started
+	std::atomic<idx_t> tasks_started;
+	//! The number of aggregation tasks completed
+	std::atomic<idx_t> tasks_completed;
+	//! Guards entering and leaving Build
+	mutex build_lock;
+	//! The number of threads inside Build
+	idx_t builders = 0;
+	//! Whether the zipped tree has been released
+	bool released = false;
 };
 
 void WindowDistinctAggregatorLocalState::Sorted() {
@@ -1817,16 +1851,96 @@ void WindowDistinctAggregatorGlobalState::PatchPrevIdcs() {
 }
 
 void WindowDistinctAggregatorGlobalState::Finalize(const FrameStats &stats) {
-	merge_sort_tree = make_uniq<DistinctSortTree>(std::move(prev_idcs), *this);
+	//	First one in allocates the tree
+	{
+		lock_guard<mutex> tree_guard(lock);
+		if (!merge_sort_tree) {
+			merge_sort_tree = make_uniq<DistinctSortTree>(std::move(prev_idcs), *this);
+		}
+	}
+
+	merge_sort_tree->Build();
 }
 
 WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedElements &&prev_idcs,
-                                                                        WindowDistinctAggregatorGlobalState &gdsink) {
+                                                                        WindowDistinctAggregatorGlobalState &gdsink)
+    : gdsink(gdsink), count(prev_idcs.size()), tasks_started(0), tasks_completed(0) {
+	auto &levels_flat_native = gdsink.levels_flat_native;
+	auto &levels_flat_start = gdsink.levels_flat_start;
+
+	//	The zipped runs are merged by all the threads
+	zipped_tree.Allocate(std::move(prev_idcs));
+
+	// compute space required to store aggregation states of merge sort tree
+	// this is one aggregate state per entry per level
+	const auto level_count = zipped_tree.tree.size();
+	levels_flat_native.Initialize(count * level_count);
+
+	//	The levels are filled in place, so lay them all out now
+	tree.reserve(level_count);
+	level_tasks.push_back(0);
+	for (idx_t level_nr = 0; level_nr < level_count; ++level_nr) {
+		levels_flat_start.push_back(level_nr * count);
+		tree.emplace_back(Elements(count), Offsets());
+
+		const auto task_width = TaskWidth(level_nr);
+		level_tasks.push_back(level_tasks.back() + (count + task_width - 1) / task_width);
+	}
+	levels_flat_start.push_back(level_count * count);
+}
+
+void WindowDistinctAggregatorGlobalState::DistinctSortTree::Build() {
+	{
+		lock_guard<mutex> build_guard(build_lock);
+		if (released) {
+			return;
+		}
+		++builders;
+	}
+
+	//	The aggregates need all the zipped levels
+	zipped_tree.Build();
+
+	//	Each level is aggregated independently, so all the tasks can run at once
+	const auto task_count = level_tasks.back();
+	if (tasks_started.load() < task_count) {
+		auto &allocator = gdsink.CreateTreeAllocator();
+		for (auto task_idx = tasks_started++; task_idx < task_count; task_idx = tasks_started++) {
+			const auto level_nr =
+			    idx_t(std::upper_bound(level_tasks.begin(), level_tasks.end(), task_idx) - level_tasks.begin()) - 1;
+			const auto task_width = TaskWidth(level_nr);
+			const auto begin = (task_idx - level_tasks[level_nr]) * task_width;
+			const auto end = MinValue<idx_t>(count, begin + task_width);
+			BuildRuns(level_nr, begin, end, allocator);
+			++tasks_completed;
+		}
+	}
+
+	ReleaseZippedTree();
+}
+
+void WindowDistinctAggregatorGlobalState::DistinctSortTree::ReleaseZippedTree() {
+	lock_guard<mutex> build_guard(build_lock);
+	--builders;
+	//	Other threads may still be merging or reading the zipped levels
+	if (builders || released || tasks_completed.load() < level_tasks.back()) {
+		return;
+	}
+
+	//	Last one out moves the cascading pointers over and releases the zipped tree
+	for (idx_t l = 0; l < tree.size(); ++l) {
+		tree[l].second = std::move(zipped_tree.tree[l].second);
+	}
+	zipped_tree.tree.clear();
+	released = true;
+}
+
+void WindowDistinctAggregatorGlobalState::DistinctSortTree::BuildRuns(idx_t level_nr, idx_t begin, idx_t end,
+                                                                      ArenaAllocator &allocator) {
 	auto &aggr = gdsink.aggregator.aggr;
-	auto &allocator = gdsink.allocator;
 	auto &inputs = gdsink.inputs;
 	auto &levels_flat_native = gdsink.levels_flat_native;
-	auto &levels_flat_start = gdsink.levels_flat_start;
+	const auto levels_flat_start = gdsink.levels_flat_start[level_nr];
 
 	//! Input data chunk, used for leaf segment aggregation
 	DataChunk leaves;
@@ -1847,70 +1961,49 @@ WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedEl
 	auto targets = FlatVector::GetData<data_ptr_t>(target_v);
 	idx_t ncombine = 0;
 
-	// compute space required to store aggregation states of merge sort tree
-	// this is one aggregate state per entry per level
-	MergeSortTree<ZippedTuple> zipped_tree(std::move(prev_idcs));
-	idx_t internal_nodes = 0;
-	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
-		internal_nodes += zipped_tree.tree[level_nr].first.size();
-	}
-	levels_flat_native.Initialize(internal_nodes);
-	levels_flat_start.push_back(0);
-	idx_t levels_flat_offset = 0;
-
-	//	Walk the distinct value tree building the intermediate aggregates
-	tree.reserve(zipped_tree.tree.size());
-	idx_t level_width = 1;
-	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
-		auto &zipped_level = zipped_tree.tree[level_nr].first;
-		vector<ElementType> level;
-		level.reserve(zipped_level.size());
-
-		for (idx_t i = 0; i < zipped_level.size(); i += level_width) {
-			//	Reset the combine state
-			data_ptr_t prev_state = nullptr;
-			auto next_limit = MinValue<idx_t>(zipped_level.size(), i + level_width);
-			for (auto j = i; j < next_limit; ++j) {
-				//	Initialise the next aggregate
-				auto curr_state = levels_flat_native.GetStatePtr(levels_flat_offset++);
-
-				//	Update this state (if it matches)
-				const auto prev_idx = std::get<0>(zipped_level[j]);
-				level.emplace_back(prev_idx);
-				if (prev_idx < i + 1) {
-					updates[nupdate] = curr_state;
-					//	input_idx
-					sel[nupdate] = UnsafeNumericCast<sel_t>(std::get<1>(zipped_level[j]));
-					++nupdate;
-				}
+	//	Walk the distinct value runs building the intermediate aggregates
+	const auto &zipped_level = zipped_tree.tree[level_nr].first;
+	auto &level = tree[level_nr].first;
+	const auto level_width = RunLength(level_nr);
+	for (idx_t i = begin; i < end; i += level_width) {
+		//	Reset the combine state
+		data_ptr_t prev_state = nullptr;
+		auto next_limit = MinValue<idx_t>(end, i + level_width);
+		for (auto j = i; j < next_limit; ++j) {
+			//	Initialise the next aggregate
+			auto curr_state = levels_flat_native.GetStatePtr(levels_flat_start + j);
+
+			//	Update this state (if it matches)
+			const auto prev_idx = std::get<0>(zipped_level[j]);
+			level[j] = prev_idx;
+			if (prev_idx < i + 1) {
+				updates[nupdate] = curr_state;
+				//	input_idx
+				sel[nupdate] = UnsafeNumericCast<sel_t>(std::get<1>(zipped_level[j]));
+				++nupdate;
+			}
 
-				//	Merge the previous state (if any)
-				if (prev_state) {
-					sources[ncombine] = prev_state;
-					targets[ncombine] = curr_state;
-					++ncombine;
-				}
-				prev_state = curr_state;
-
-				//	Flush the states if one is maxed out.
-				if (MaxValue<idx_t>(ncombine, nupdate) >= STANDARD_VECTOR_SIZE) {
-					//	Push the updates first so they propagate
-					leaves.Reference(inputs);
-					leaves.Slice(sel, nupdate);
-					aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
-					nupdate = 0;
-
-					//	Combine the states sequentially
-					aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
-					ncombine = 0;
-				}
+			//	Merge the previous state (if any)
+			if (prev_state) {
+				sources[ncombine] = prev_state;
+				targets[ncombine] = curr_state;
+				++ncombine;
+			}
+			prev_state = curr_state;
+
+			//	Flush the states if one is maxed out.
+			if (MaxValue<idx_t>(ncombine, nupdate) >= STANDARD_VECTOR_SIZE) {
+				//	Push the updates first so they propagate
+				leaves.Reference(inputs);
+				leaves.Slice(sel, nupdate);
+				aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
+				nupdate = 0;
+
+				//	Combine the states sequentially
+				aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
+				ncombine = 0;
 			}
 		}
-
-		tree.emplace_back(std::move(level), std::move(zipped_tree.tree[level_nr].second));
-
-		levels_flat_start.push_back(levels_flat_offset);
-		level_width *= FANOUT;
 	}
 
 	//	Flush any remaining states
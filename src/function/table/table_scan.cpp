@@ -15,6 +15,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table/statistics_aggregate.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/main/client_data.hpp"
@@ -74,6 +75,7 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		col = storage_idx;
 	}
 	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	result->scan_state.options.statistics_aggregates = bind_data.statistics_aggregates.get();
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
 		auto &tsgs = gstate->Cast<TableScanGlobalState>();
@@ -91,6 +93,9 @@ unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context,
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
 	auto result = make_uniq<TableScanGlobalState>(context, input.bind_data.get());
 	bind_data.table.GetStorage().InitializeParallelScan(context, result->state);
+	if (bind_data.statistics_aggregates) {
+		bind_data.statistics_aggregates->Reset();
+	}
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
 		const auto &columns = bind_data.table.GetColumns();
@@ -0,0 +1,24 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/thread_pin_mode.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class ThreadPinMode : uint8_t {
+	//! Never pin the worker threads
+	OFF = 0,
+	//! Always pin every worker thread to its own core
+	ON = 1,
+	//! Pin the worker threads only if the process runs on more than one NUMA node
+	AUTO = 2
+};
+
+} // namespace duckdb
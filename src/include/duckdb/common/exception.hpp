@@ -286,6 +286,7 @@ public:
 class InterruptException : public Exception {
 public:
 	DUCKDB_API InterruptException();
+	DUCKDB_API explicit InterruptException(const string &msg);
 };
 
 class FatalException : public Exception {
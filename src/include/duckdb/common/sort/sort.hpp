@@ -22,6 +22,11 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Size of the string prefix stored in the sorting key (including the NULL byte)
+	static constexpr idx_t STRING_PREFIX_SIZE = 12;
+	//! Strings that are known to fit in this size (including the NULL byte) are fully normalized into the sorting key,
+	//! so no ties have to be broken using the blob sorting data
+	static constexpr idx_t MAX_NORMALIZED_STRING_SIZE = 32;
 };
 
 struct SortLayout {
@@ -320,6 +320,16 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The number of entries in the child of the dictionary vector, if known
+	//! Operations can use this to process every entry of the dictionary once, instead of once for every row
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
+	static inline void SetDictionarySize(Vector &vector, idx_t size) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		vector.buffer->Cast<DictionaryBuffer>().SetDictionarySize(size);
+	}
 };
 
 struct FlatVector {
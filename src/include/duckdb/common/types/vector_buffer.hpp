@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/common/types/string_type.hpp"
@@ -159,9 +160,17 @@ public:
 	void SetSelVector(const SelectionVector &vector) {
 		this->sel_vector.Initialize(vector);
 	}
+	//! The number of entries in the dictionary (if known)
+	optional_idx GetDictionarySize() const {
+		return dictionary_size;
+	}
+	void SetDictionarySize(idx_t size) {
+		dictionary_size = size;
+	}
 
 private:
 	SelectionVector sel_vector;
+	optional_idx dictionary_size;
 };
 
 class VectorStringBuffer : public VectorBuffer {
@@ -167,6 +167,32 @@ private:
 		}
 	}
 
+	//! Update loop for dictionaries of a known size (e.g. the runs of an RLE segment)
+	//! Consecutive rows that point to the same dictionary entry are handled with a single ConstantOperation
+	template <class STATE_TYPE, class INPUT_TYPE, class OP>
+	static inline void UnaryDictionaryUpdateLoop(const INPUT_TYPE *__restrict idata,
+	                                             AggregateInputData &aggr_input_data, STATE_TYPE *__restrict state,
+	                                             idx_t count, ValidityMask &mask,
+	                                             const SelectionVector &__restrict dictionary_sel,
+	                                             const SelectionVector &__restrict sel_vector) {
+		AggregateUnaryInput input(aggr_input_data, mask);
+		idx_t i = 0;
+		while (i < count) {
+			auto entry_idx = sel_vector.get_index(i);
+			idx_t run_length = 1;
+			while (i + run_length < count && sel_vector.get_index(i + run_length) == entry_idx) {
+				run_length++;
+			}
+			i += run_length;
+			input.input_idx = dictionary_sel.get_index(entry_idx);
+			if (OP::IgnoreNull() && !mask.RowIsValid(input.input_idx)) {
+				continue;
+			}
+			OP::template ConstantOperation<INPUT_TYPE, STATE_TYPE, OP>(*state, idata[input.input_idx], input,
+			                                                           run_length);
+		}
+	}
+
 	template <class STATE_TYPE, class A_TYPE, class B_TYPE, class OP>
 	static inline void BinaryScatterLoop(const A_TYPE *__restrict adata, AggregateInputData &aggr_input_data,
 	                                     const B_TYPE *__restrict bdata, STATE_TYPE **__restrict states, idx_t count,
@@ -293,6 +319,24 @@ public:
 			                                                FlatVector::Validity(input));
 			break;
 		}
+		case VectorType::DICTIONARY_VECTOR: {
+			auto dictionary_size = DictionaryVector::DictionarySize(input);
+			if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= count) {
+				// unknown or large dictionary: use the generic path
+				UnifiedVectorFormat idata;
+				input.ToUnifiedFormat(count, idata);
+				UnaryUpdateLoop<STATE_TYPE, INPUT_TYPE, OP>(UnifiedVectorFormat::GetData<INPUT_TYPE>(idata),
+				                                            aggr_input_data, (STATE_TYPE *)state, count,
+				                                            idata.validity, *idata.sel);
+				break;
+			}
+			UnifiedVectorFormat idata;
+			DictionaryVector::Child(input).ToUnifiedFormat(dictionary_size.GetIndex(), idata);
+			UnaryDictionaryUpdateLoop<STATE_TYPE, INPUT_TYPE, OP>(
+			    UnifiedVectorFormat::GetData<INPUT_TYPE>(idata), aggr_input_data, (STATE_TYPE *)state, count,
+			    idata.validity, *idata.sel, DictionaryVector::SelVector(input));
+			break;
+		}
 		default: {
 			UnifiedVectorFormat idata;
 			input.ToUnifiedFormat(count, idata);
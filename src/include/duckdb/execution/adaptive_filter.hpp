@@ -19,31 +19,47 @@ struct AdaptiveFilterState {
 	time_point<high_resolution_clock> start_time;
 };
 
+//! AdaptiveFilter orders a set of predicates (the children of a conjunction or the filters of a table scan) based on
+//! their measured cost and on how many tuples they eliminate from the evaluation of the subsequent predicates
 class AdaptiveFilter {
 public:
 	explicit AdaptiveFilter(const Expression &expr);
 	explicit AdaptiveFilter(const TableFilterSet &table_filters);
 
+	//! The order in which the predicates are evaluated
 	vector<idx_t> permutation;
 
 public:
-	void AdaptRuntimeStatistics(double duration);
+	//! Start measuring the evaluation of a single predicate
+	AdaptiveFilterState BeginPredicate() const;
+	//! Record the evaluation of the predicate "predicate_idx" on "input_count" tuples, of which "eliminated_count" do
+	//! not have to be evaluated by the subsequent predicates
+	void EndPredicate(AdaptiveFilterState state, idx_t predicate_idx, idx_t input_count, idx_t eliminated_count);
+	//! Finish the evaluation of a batch of tuples, periodically reorders the predicates
+	void EndFilter();
 
-	AdaptiveFilterState BeginFilter() const;
-	void EndFilter(AdaptiveFilterState state);
+private:
+	struct PredicateStatistics {
+		//! Total time spent evaluating the predicate
+		double runtime = 0;
+		//! Number of tuples the predicate was evaluated on
+		double input_count = 0;
+		//! Number of tuples the predicate eliminated
+		double eliminated_count = 0;
+	};
+
+	//! Sort the predicates by their cost per eliminated tuple
+	void ReorderPredicates();
 
 private:
-	//! used for adaptive expression reordering
+	//! The number of batches between reordering the predicates
+	static constexpr idx_t REORDER_INTERVAL = 16;
+	//! The weight of the statistics of earlier batches after reordering
+	static constexpr double STATISTICS_DECAY = 0.5;
+
+	//! Runtime statistics per predicate
+	vector<PredicateStatistics> statistics;
+	//! The number of batches since the last reordering
 	idx_t iteration_count = 0;
-	idx_t swap_idx = 0;
-	idx_t right_random_border = 0;
-	idx_t observe_interval = 0;
-	idx_t execute_interval = 0;
-	double runtime_sum = 0;
-	double prev_mean = 0;
-	bool observe = false;
-	bool warmup = false;
-	vector<idx_t> swap_likeliness;
-	RandomEngine generator;
 };
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/pending_execution_result.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -59,6 +60,9 @@ public:
 
 	void Reset();
 
+	//! Throws an InterruptException if the statement_timeout of the query has expired
+	void CheckStatementTimeout() const;
+
 	vector<LogicalType> GetTypes();
 
 	//! Push a new error
@@ -127,6 +131,9 @@ private:
 	//! Check if the streaming query result is waiting to be fetched from, must hold the 'executor_lock'
 	bool ResultCollectorIsBlocked();
 	void InitializeInternal(PhysicalOperator &physical_plan);
+	//! Whether the statement_timeout of the query has expired
+	bool StatementTimeoutExpired() const;
+	string StatementTimeoutMessage() const;
 
 	void ScheduleEvents(const vector<shared_ptr<MetaPipeline>> &meta_pipelines);
 	void ScheduleEventsInternal(ScheduleEventData &event_data);
@@ -174,6 +181,10 @@ private:
 	idx_t total_pipelines;
 	//! Whether or not execution is cancelled
 	bool cancelled;
+	//! Whether or not the query has a statement_timeout
+	bool has_deadline = false;
+	//! The point in time at which the statement_timeout of the query expires
+	steady_clock::time_point deadline;
 
 	//! The last pending execution result (if any)
 	PendingExecutionResult execution_result;
@@ -144,6 +144,11 @@ protected:
 	idx_t Select(const BoundConjunctionExpression &expr, ExpressionState *state, const SelectionVector *sel,
 	             idx_t count, SelectionVector *true_sel, SelectionVector *false_sel);
 
+	//! Evaluate the leaves of a fused comparison, returns true if the fused kernel can be used on them
+	bool ExecuteFusedLeaves(FusedComparison &fused, const SelectionVector *sel, idx_t count);
+	//! Evaluate the sides of a fused comparison from its leaves one operator at a time, without the fused kernel
+	void ExecuteFusedChildren(FusedComparison &fused, idx_t count, Vector &left, Vector &right);
+
 	//! Verify that the output of a step in the ExpressionExecutor is correct
 	void Verify(const Expression &expr, Vector &result, idx_t count);
 
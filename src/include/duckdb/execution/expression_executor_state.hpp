@@ -15,6 +15,8 @@
 namespace duckdb {
 class Expression;
 class ExpressionExecutor;
+class BoundComparisonExpression;
+class BoundFunctionExpression;
 struct ExpressionExecutorState;
 struct FunctionLocalState;
 
@@ -56,6 +58,12 @@ struct ExecuteFunctionState : public ExpressionState {
 	~ExecuteFunctionState() override;
 
 	unique_ptr<FunctionLocalState> local_state;
+	//! Whether or not the function can be executed once per dictionary entry for dictionary inputs
+	bool dictionary_execution = true;
+	//! The dictionary for which the function result was last computed
+	buffer_ptr<VectorBuffer> cached_dictionary;
+	//! The result of the function for every entry of the cached dictionary
+	unique_ptr<Vector> cached_dictionary_result;
 
 public:
 	static optional_ptr<FunctionLocalState> GetFunctionState(ExpressionState &state) {
@@ -63,6 +71,49 @@ public:
 	}
 };
 
+//! An input of a fused kernel: a flat vector (stride 1) or a constant (stride 0) without NULL values
+struct FusedInput {
+	const_data_ptr_t data;
+	idx_t stride;
+};
+
+//! A fused kernel selects the rows for which the comparison holds - it returns false if the arithmetic overflows
+typedef bool (*fused_select_t)(const FusedInput inputs[], const SelectionVector *sel, idx_t count,
+                               SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count);
+
+//! FusedComparison evaluates a comparison between a tree of numeric arithmetic (e.g. a * b + c > d) in a single loop
+//! that is specialized for the operators in the tree, without materializing the intermediate results
+struct FusedComparison {
+	//! Returns the fused comparison for a comparison and its state, or nullptr if the comparison cannot be fused
+	static unique_ptr<FusedComparison> TryCreate(const BoundComparisonExpression &expr, ExpressionState &state);
+
+	//! The fused kernel
+	fused_select_t kernel;
+	//! The leaves of the arithmetic tree, followed by the other side of the comparison
+	vector<reference<const Expression>> leaves;
+	vector<reference<ExpressionState>> leaf_states;
+	//! The arithmetic operators, from the bottom up
+	vector<reference<const BoundFunctionExpression>> nodes;
+	vector<reference<ExpressionState>> node_states;
+	//! Whether the nested operator is the right child of the top operator
+	bool nested_right = false;
+	//! Whether the arithmetic is on the right side of the comparison
+	bool arithmetic_right = false;
+	//! The evaluated leaves, and the inputs of the kernel pointing to them
+	DataChunk leaf_chunk;
+	vector<FusedInput> inputs;
+	//! The rows that pass the comparison (used when computing a boolean result)
+	SelectionVector true_sel;
+};
+
+struct ExecuteComparisonState : public ExpressionState {
+	ExecuteComparisonState(const Expression &expr, ExpressionExecutorState &root);
+	~ExecuteComparisonState() override;
+
+	//! The fused kernel for the comparison (if any)
+	unique_ptr<FusedComparison> fused;
+};
+
 struct ExpressionExecutorState {
 	ExpressionExecutorState();
 
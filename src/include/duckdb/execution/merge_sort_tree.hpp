@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/printer.hpp"
@@ -16,6 +17,7 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/vector_operations/aggregate_executor.hpp"
 #include <iomanip>
+#include <thread>
 
 namespace duckdb {
 
@@ -82,6 +84,7 @@ struct MergeSortTree {
 	using RunElement = pair<ElementType, idx_t>;
 	using RunElements = array<RunElement, F>;
 	using Games = array<RunElement, F - 1>;
+	using AtomicCounters = vector<std::atomic<idx_t>>;
 
 	struct CompareElements {
 		explicit CompareElements(const CMP &cmp) : cmp(cmp) {
@@ -100,10 +103,37 @@ struct MergeSortTree {
 		CMP cmp;
 	};
 
-	explicit MergeSortTree(const CMP &cmp = CMP()) : cmp(cmp) {
+	explicit MergeSortTree(const CMP &cmp = CMP()) : cmp(cmp), build_level(0) {
 	}
 	explicit MergeSortTree(Elements &&lowest_level, const CMP &cmp = CMP());
 
+	//! Allocate the levels above the lowest one so the runs can be built independently
+	void Allocate(Elements &&lowest_level);
+	//! Build the remaining runs. This can be called from multiple threads,
+	//! and returns once all the levels are complete.
+	void Build();
+	//! Merge the child runs of a single run
+	void BuildRun(idx_t level_nr, idx_t run_idx);
+	//! Whether all the levels have been built
+	bool IsBuilt() const {
+		return build_level.load() >= tree.size();
+	}
+
+	//! The length of the runs in a level
+	static idx_t RunLength(idx_t level_nr) {
+		idx_t run_length = 1;
+		for (idx_t i = 0; i < level_nr; ++i) {
+			run_length *= FANOUT;
+		}
+		return run_length;
+	}
+	//! The number of runs in a level
+	idx_t RunCount(idx_t level_nr) const {
+		const auto count = tree.front().first.size();
+		const auto run_length = RunLength(level_nr);
+		return (count + run_length - 1) / run_length;
+	}
+
 	idx_t SelectNth(const SubFrames &frames, idx_t n) const;
 
 	inline ElementType NthElement(idx_t i) const {
@@ -119,6 +149,13 @@ struct MergeSortTree {
 	static constexpr auto FANOUT = F;
 	static constexpr auto CASCADING = C;
 
+	//! The level being built
+	std::atomic<idx_t> build_level;
+	//! The number of runs started so far at each level
+	unique_ptr<AtomicCounters> build_started;
+	//! The number of runs completed so far at each level
+	unique_ptr<AtomicCounters> build_completed;
+
 protected:
 	RunElement StartGames(Games &losers, const RunElements &elements, const RunElement &sentinel) {
 		const auto elem_nodes = elements.size();
@@ -250,92 +287,162 @@ protected:
 };
 
 template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
-MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp) : cmp(cmp) {
+MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp) : cmp(cmp), build_level(0) {
+	Allocate(std::move(lowest_level));
+	Build();
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Allocate(Elements &&lowest_level) {
 	const auto fanout = F;
 	const auto cascading = C;
 	const auto count = lowest_level.size();
+	tree.clear();
 	tree.emplace_back(Level(std::move(lowest_level), Offsets()));
 
-	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
-
-	//	Fan in parent levels until we are at the top
+	//	Size the parent levels up to the top
 	//	Note that we don't build the top layer as that would just be all the data.
 	for (idx_t child_run_length = 1; child_run_length < count;) {
 		const auto run_length = child_run_length * fanout;
-		const auto num_runs = (count + run_length - 1) / run_length;
 
-		Elements elements;
-		elements.reserve(count);
+		Elements elements(count);
 
 		//	Allocate cascading pointers only if there is room
+		//	Each run has pointers for every cascading boundary, plus two terminal entries
 		Offsets cascades;
 		if (cascading > 0 && run_length > cascading) {
-			const auto num_cascades = fanout * num_runs * (run_length / cascading + 2);
-			cascades.reserve(num_cascades);
+			const auto full_runs = count / run_length;
+			const auto partial = count % run_length;
+			auto num_cascades = fanout * full_runs * (run_length / cascading + 2);
+			if (partial) {
+				num_cascades += fanout * ((partial + cascading - 1) / cascading + 2);
+			}
+			cascades.resize(num_cascades);
 		}
 
-		//	Create each parent run by merging the child runs using a tournament tree
-		// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
-		//	TODO: Because the runs are independent, they can be parallelised with parallel_for
-		const auto &child_level = tree.back();
-		for (idx_t run_idx = 0; run_idx < num_runs; ++run_idx) {
-			//	Position markers for scanning the children.
-			using Bounds = pair<idx_t, idx_t>;
-			array<Bounds, fanout> bounds;
-			//	Start with first element of each (sorted) child run
-			RunElements players;
-			const auto child_base = run_idx * run_length;
-			for (idx_t child_run = 0; child_run < fanout; ++child_run) {
-				const auto child_idx = child_base + child_run * child_run_length;
-				bounds[child_run] = {MinValue<idx_t>(child_idx, count),
-				                     MinValue<idx_t>(child_idx + child_run_length, count)};
-				if (bounds[child_run].first != bounds[child_run].second) {
-					players[child_run] = {child_level.first[child_idx], child_run};
-				} else {
-					//	Empty child
-					players[child_run] = SENTINEL;
-				}
-			}
+		tree.emplace_back(std::move(elements), std::move(cascades));
+		child_run_length = run_length;
+	}
 
-			//	Play the first round and extract the winner
-			Games games;
-			auto winner = StartGames(games, players, SENTINEL);
-			while (winner != SENTINEL) {
-				// Add fractional cascading pointers
-				// if we are on a fraction boundary
-				if (cascading > 0 && run_length > cascading && elements.size() % cascading == 0) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+	//	Start by building the first parent level
+	build_level = 1;
 
-				//	Insert new winner element into the current run
-				elements.emplace_back(winner.first);
-				const auto child_run = winner.second;
-				auto &child_idx = bounds[child_run].first;
-				++child_idx;
-
-				//	Move to the next entry in the child run (if any)
-				if (child_idx < bounds[child_run].second) {
-					winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
-				} else {
-					winner = ReplayGames(games, child_run, SENTINEL);
-				}
+	build_started = make_uniq<AtomicCounters>(tree.size());
+	for (auto &counter : *build_started) {
+		counter = 0;
+	}
+
+	build_completed = make_uniq<AtomicCounters>(tree.size());
+	for (auto &counter : *build_completed) {
+		counter = 0;
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Build() {
+	//	Each level depends on the one below it, but the runs within a level are independent.
+	for (;;) {
+		const idx_t level_nr = build_level.load();
+		if (level_nr >= tree.size()) {
+			break;
+		}
+
+		//	Claim the next run of this level
+		const auto run_count = RunCount(level_nr);
+		const idx_t run_idx = (*build_started).at(level_nr)++;
+		if (run_idx >= run_count) {
+			//	Nothing left at this level, so wait until other threads are done.
+			while (level_nr == build_level.load()) {
+				std::this_thread::yield();
 			}
+			continue;
+		}
 
-			// Add terminal cascade pointers to the end
-			if (cascading > 0 && run_length > cascading) {
-				for (idx_t j = 0; j < 2; ++j) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+		BuildRun(level_nr, run_idx);
+
+		//	If that was the last one, mark the level as complete.
+		const idx_t build_complete = ++(*build_completed).at(level_nr);
+		if (build_complete == run_count) {
+			++build_level;
+		}
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::BuildRun(idx_t level_nr, idx_t run_idx) {
+	const auto fanout = F;
+	const auto cascading = C;
+
+	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
+
+	//	Create the parent run by merging the child runs using a tournament tree
+	// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
+	const auto &child_level = tree[level_nr - 1];
+	const auto count = child_level.first.size();
+	const auto child_run_length = RunLength(level_nr - 1);
+	const auto run_length = child_run_length * fanout;
+
+	//	The runs are written in place, so each run has a fixed position in the level
+	auto &level = tree[level_nr];
+	const auto child_base = run_idx * run_length;
+	auto elements = level.first.data() + child_base;
+	idx_t element_idx = 0;
+
+	const auto has_cascades = (cascading > 0 && run_length > cascading);
+	auto cascades = level.second.data();
+	if (has_cascades) {
+		cascades += run_idx * fanout * (run_length / cascading + 2);
+	}
+
+	//	Position markers for scanning the children.
+	using Bounds = pair<idx_t, idx_t>;
+	array<Bounds, fanout> bounds;
+	//	Start with first element of each (sorted) child run
+	RunElements players;
+	for (idx_t child_run = 0; child_run < fanout; ++child_run) {
+		const auto child_idx = child_base + child_run * child_run_length;
+		bounds[child_run] = {MinValue<idx_t>(child_idx, count), MinValue<idx_t>(child_idx + child_run_length, count)};
+		if (bounds[child_run].first != bounds[child_run].second) {
+			players[child_run] = {child_level.first[child_idx], child_run};
+		} else {
+			//	Empty child
+			players[child_run] = SENTINEL;
+		}
+	}
+
+	//	Play the first round and extract the winner
+	Games games;
+	auto winner = StartGames(games, players, SENTINEL);
+	while (winner != SENTINEL) {
+		// Add fractional cascading pointers
+		// if we are on a fraction boundary
+		if (has_cascades && element_idx % cascading == 0) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				*cascades++ = bounds[i].first;
 			}
 		}
 
-		//	Insert completed level and move up to the next one
-		tree.emplace_back(std::move(elements), std::move(cascades));
-		child_run_length = run_length;
+		//	Insert new winner element into the current run
+		elements[element_idx++] = winner.first;
+		const auto child_run = winner.second;
+		auto &child_idx = bounds[child_run].first;
+		++child_idx;
+
+		//	Move to the next entry in the child run (if any)
+		if (child_idx < bounds[child_run].second) {
+			winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
+		} else {
+			winner = ReplayGames(games, child_run, SENTINEL);
+		}
+	}
+
+	// Add terminal cascade pointers to the end
+	if (has_cascades) {
+		for (idx_t j = 0; j < 2; ++j) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				*cascades++ = bounds[i].first;
+			}
+		}
 	}
 }
 
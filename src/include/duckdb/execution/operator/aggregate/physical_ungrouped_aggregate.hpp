@@ -17,6 +17,7 @@
 #include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
+class StatisticsAggregateState;
 
 //! PhysicalUngroupedAggregate is an aggregate operator that can only perform aggregates (1) without any groups, (2)
 //! without any DISTINCT aggregates, and (3) when all aggregates are combineable
@@ -32,6 +33,8 @@ public:
 	vector<unique_ptr<Expression>> aggregates;
 	unique_ptr<DistinctAggregateData> distinct_data;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
+	//! The aggregates over the row groups that the table scan below answered from their statistics (if any)
+	shared_ptr<StatisticsAggregateState> statistics_aggregates;
 
 public:
 	// Source interface
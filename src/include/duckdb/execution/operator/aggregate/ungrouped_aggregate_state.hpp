@@ -14,6 +14,7 @@
 
 namespace duckdb {
 struct DistinctAggregateData;
+class StatisticsAggregateState;
 struct LocalUngroupedAggregateState;
 
 struct UngroupedAggregateState {
@@ -56,6 +57,8 @@ public:
 	ArenaAllocator &CreateAllocator() const;
 	void Combine(LocalUngroupedAggregateState &other);
 	void CombineDistinct(LocalUngroupedAggregateState &other, DistinctAggregateData &distinct_data);
+	//! Combine the aggregates over the row groups that were answered from their statistics
+	void CombineStatistics(StatisticsAggregateState &statistics);
 	void Finalize(DataChunk &result);
 };
 
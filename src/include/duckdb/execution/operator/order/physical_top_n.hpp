@@ -12,6 +12,7 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+class DynamicTableFilterSet;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -26,6 +27,10 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! Dynamic table filters of the scan below this operator (if any), that receive the current boundary value
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The scan column index the boundary value of the first order is pushed into
+	idx_t dynamic_filter_column = DConstants::INVALID_INDEX;
 
 public:
 	// Source interface
@@ -191,6 +191,16 @@ public:
 	GetGlobalState(const idx_t payload_count, const ValidityMask &partition_mask, const ValidityMask &order_mask) const;
 	virtual unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const;
 
+	//! Can this executor reuse the data built by the other (earlier) executor?
+	virtual bool CanShare(const WindowExecutor &other) const {
+		return false;
+	}
+	//! Create a global state that reuses the data built by an earlier executor's global state
+	virtual unique_ptr<WindowExecutorGlobalState> GetSharedGlobalState(WindowExecutorGlobalState &shared,
+	                                                                   const idx_t payload_count,
+	                                                                   const ValidityMask &partition_mask,
+	                                                                   const ValidityMask &order_mask) const;
+
 	virtual void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count,
 	                  WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const;
 
@@ -221,6 +231,12 @@ public:
 	                                                     const ValidityMask &order_mask) const override;
 	unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const override;
 
+	bool CanShare(const WindowExecutor &other) const override;
+	unique_ptr<WindowExecutorGlobalState> GetSharedGlobalState(WindowExecutorGlobalState &shared,
+	                                                           const idx_t payload_count,
+	                                                           const ValidityMask &partition_mask,
+	                                                           const ValidityMask &order_mask) const override;
+
 	const WindowAggregationMode mode;
 
 protected:
@@ -15,6 +15,7 @@
 namespace duckdb {
 class DuckTableEntry;
 class TableCatalogEntry;
+class StatisticsAggregateState;
 
 struct TableScanBindData : public TableFunctionData {
 	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
@@ -29,6 +30,8 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch in case of an index scan.
 	vector<row_t> row_ids;
+	//! The ungrouped aggregates over the scan that are answered from row group statistics where possible (if any)
+	shared_ptr<StatisticsAggregateState> statistics_aggregates;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
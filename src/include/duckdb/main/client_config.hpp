@@ -123,6 +123,16 @@ struct ClientConfig {
 	//! Output error messages as structured JSON instead of as a raw string
 	bool errors_as_json = false;
 
+	//! The share of the worker threads queries of this connection receive relative to other connections
+	idx_t scheduler_weight = 1;
+	//! The maximum number of worker threads a single query of this connection can use (0 = no limit)
+	idx_t scheduler_max_threads = 0;
+
+	//! The maximum memory that operators of a single query of this connection can reserve (default: memory_limit)
+	idx_t query_memory_limit = NumericLimits<idx_t>::Maximum();
+	//! The maximum time in milliseconds a query of this connection can execute before it is cancelled (0 = no limit)
+	idx_t statement_timeout = 0;
+
 	//! Generic options
 	case_insensitive_map_t<Value> set_variables;
 
@@ -32,6 +32,8 @@ private:
 	//! Second iteration: perform the actual replacement of the duplicate expressions with common subexpressions nodes
 	void PerformCSEReplacement(unique_ptr<Expression> &expr, CSEReplacementState &state);
 
+	//! Extract the expressions the operator shares with the filter directly below it into a projection below the filter
+	void ExtractFilterSubExpressions(LogicalOperator &op);
 	//! Main method to extract common subexpressions
 	void ExtractCommonSubExpresions(LogicalOperator &op);
 
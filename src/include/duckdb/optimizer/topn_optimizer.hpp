@@ -12,6 +12,7 @@
 
 namespace duckdb {
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
@@ -20,6 +21,8 @@ public:
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+	//! Set up a dynamic filter on the scan below the TopN for the boundary value of its first order
+	static void PushdownDynamicFilters(LogicalTopN &op);
 };
 
 } // namespace duckdb
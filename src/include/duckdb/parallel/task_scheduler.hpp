@@ -10,7 +10,9 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -23,14 +25,17 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct ProducerState;
+struct ProducerSnapshot;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, shared_ptr<ProducerState> state);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
-	unique_ptr<QueueProducerToken> token;
-	mutex producer_lock;
+	//! The queue and scheduling state of the producer - shared with the worker threads that run its tasks, so it
+	//! outlives the token while they do
+	shared_ptr<ProducerState> state;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
@@ -46,6 +51,8 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
 	unique_ptr<ProducerToken> CreateProducer();
+	//! Create a producer that is scheduled using the weight and thread limit of the client
+	unique_ptr<ProducerToken> CreateProducer(ClientContext &context);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -87,6 +94,18 @@ public:
 private:
 	void RelaunchThreadsInternal(int32_t n);
 
+	unique_ptr<ProducerToken> CreateProducer(idx_t weight, idx_t max_threads);
+	//! Removes a producer that is being destroyed, any tasks it still has queued are handed to the orphan producer
+	void RemoveProducer(ProducerToken &producer);
+	//! Updates the producers a worker thread chooses from, if producers were added or removed since
+	void RefreshProducers(ProducerSnapshot &snapshot);
+	//! Fetches the next task for a worker thread, choosing between producers using deficit round-robin
+	bool DequeueTask(ProducerSnapshot &snapshot, shared_ptr<Task> &task, optional_ptr<ProducerState> &producer);
+	//! Marks a task fetched through DequeueTask as no longer running
+	void FinishTask(ProducerState &producer);
+
+	friend struct ProducerToken;
+
 private:
 	DatabaseInstance &db;
 	//! The task queue
@@ -105,6 +124,19 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! How the background threads are currently pinned to cores
+	ThreadPinMode thread_pin_mode;
+	//! Lock for adding and removing producers
+	mutex producer_lock;
+	//! The producers in round-robin order - the list is replaced rather than modified, so worker threads can keep
+	//! choosing from their copy without taking the lock
+	shared_ptr<vector<shared_ptr<ProducerState>>> producers;
+	//! Incremented whenever the list of producers is replaced
+	atomic<idx_t> producers_version;
+	//! The round-robin position of the producer whose turn it is
+	atomic<idx_t> next_producer;
+	//! Producer that takes over the queued tasks of producers that are destroyed
+	unique_ptr<ProducerToken> orphan_producer;
 };
 
 } // namespace duckdb
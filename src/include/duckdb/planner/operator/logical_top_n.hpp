@@ -12,6 +12,7 @@
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
+class DynamicTableFilterSet;
 
 //! LogicalTopN represents a comibination of ORDER BY and LIMIT clause, using Min/Max Heap
 class LogicalTopN : public LogicalOperator {
@@ -20,7 +21,8 @@ public:
 
 public:
 	LogicalTopN(vector<BoundOrderByNode> orders, idx_t limit, idx_t offset)
-	    : LogicalOperator(LogicalOperatorType::LOGICAL_TOP_N), orders(std::move(orders)), limit(limit), offset(offset) {
+	    : LogicalOperator(LogicalOperatorType::LOGICAL_TOP_N), orders(std::move(orders)), limit(limit), offset(offset),
+	      dynamic_filter_column(DConstants::INVALID_INDEX) {
 	}
 
 	vector<BoundOrderByNode> orders;
@@ -28,6 +30,10 @@ public:
 	idx_t limit;
 	//! The offset from the start to begin emitting elements
 	idx_t offset;
+	//! The dynamic filters of the scan that the boundary value of the first order is pushed into (if any)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The column index of the scan that the dynamic filter applies to
+	idx_t dynamic_filter_column;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
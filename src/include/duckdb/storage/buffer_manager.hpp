@@ -94,6 +94,8 @@ public:
 	}
 	//! Returns the maximum available memory for a given query
 	idx_t GetQueryMaxMemory() const;
+	//! Returns the maximum available memory for a query of the given client, taking its query_memory_limit into account
+	idx_t GetQueryMaxMemory(ClientContext &context) const;
 
 	//! Get the manager that assigns reservations for temporary memory, e.g., for query intermediates
 	virtual TemporaryMemoryManager &GetTemporaryMemoryManager();
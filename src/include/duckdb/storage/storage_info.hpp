@@ -42,6 +42,9 @@ struct Storage {
 	constexpr static const idx_t ROW_GROUP_SIZE = STANDARD_ROW_GROUPS_SIZE;
 	//! The number of vectors per row group
 	constexpr static const idx_t ROW_GROUP_VECTOR_COUNT = ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE;
+	//! The minimum number of vectors handed out to a thread when the tail of a parallel scan is split up
+	constexpr static const idx_t MIN_PARALLEL_SCAN_VECTOR_COUNT =
+	    ROW_GROUP_VECTOR_COUNT < 16 ? ROW_GROUP_VECTOR_COUNT : 16;
 
 	//! The minimum block allocation size. This is the minimum size we test in our nightly tests.
 	constexpr static idx_t MIN_BLOCK_ALLOC_SIZE = 16384ULL;
@@ -173,6 +173,8 @@ public:
 	void MergeStatistics(const BaseStatistics &other);
 	void MergeIntoStatistics(BaseStatistics &other);
 	unique_ptr<BaseStatistics> GetStatistics();
+	//! Replaces the statistics of the column, e.g. with the statistics of the data written by a checkpoint
+	void SetStatistics(const BaseStatistics &other);
 
 protected:
 	//! Append a transient segment
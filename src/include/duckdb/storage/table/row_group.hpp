@@ -46,6 +46,7 @@ struct RowGroupAppendState;
 class MetadataManager;
 class RowVersionManager;
 class ScanFilterInfo;
+class StatisticsAggregateState;
 class StorageCommitState;
 
 struct RowGroupWriteInfo {
@@ -113,6 +114,10 @@ public:
 	//! Checks the given set of table filters against the per-segment statistics. Returns false if any segments were
 	//! skipped.
 	bool CheckZonemapSegments(CollectionScanState &state);
+	//! Answers the ungrouped aggregates over a scan of the entire row group from its statistics, if all rows are
+	//! visible, all filters are always true and the statistics of the aggregated columns are exact. Returns false if
+	//! the row group has to be scanned instead.
+	bool TryAggregateStatistics(ScanFilterInfo &filters, StatisticsAggregateState &state);
 	void Scan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 	void ScanCommitted(CollectionScanState &state, DataChunk &result, TableScanType type);
 
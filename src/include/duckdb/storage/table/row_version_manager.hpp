@@ -28,6 +28,8 @@ public:
 	}
 	void SetStart(idx_t start);
 	idx_t GetCommittedDeletedCount(idx_t count);
+	//! Returns true if any version information is left, i.e. if any row is not visible to every transaction
+	bool HasChunkInfo();
 
 	idx_t GetSelVector(TransactionData transaction, idx_t vector_idx, SelectionVector &sel_vector, idx_t max_count);
 	idx_t GetCommittedSelVector(transaction_t start_time, transaction_t transaction_id, idx_t vector_idx,
@@ -34,8 +34,8 @@ class ColumnData;
 class DuckTransaction;
 class RowGroupSegmentTree;
 class TableFilter;
-struct AdaptiveFilterState;
 struct TableScanOptions;
+class StatisticsAggregateState;
 
 struct SegmentScanState {
 	virtual ~SegmentScanState() {
@@ -86,6 +86,8 @@ struct ColumnScanState {
 	vector<ColumnScanState> child_states;
 	//! Whether or not InitializeState has been called for this segment
 	bool initialized = false;
+	//! Whether the segment was still transient when InitializeState was called for it
+	bool transient_segment = false;
 	//! If this segment has already been checked for skipping purposes
 	bool segment_checked = false;
 	//! We initialize one SegmentScanState per segment, however, if scanning a DataChunk requires us to scan over more
@@ -137,8 +139,6 @@ public:
 	}
 
 	optional_ptr<AdaptiveFilter> GetAdaptiveFilter();
-	AdaptiveFilterState BeginFilter() const;
-	void EndFilter(AdaptiveFilterState state);
 
 	//! Whether or not there is any filter we need to execute
 	bool HasFilters() const;
@@ -204,6 +204,9 @@ private:
 struct TableScanOptions {
 	//! Fetch rows one-at-a-time instead of using the regular scans.
 	bool force_fetch_row = false;
+	//! Ungrouped aggregates over the scan - row groups that fully pass the filters are answered from their
+	//! statistics if possible, instead of being scanned
+	optional_ptr<StatisticsAggregateState> statistics_aggregates;
 };
 
 class TableScanState {
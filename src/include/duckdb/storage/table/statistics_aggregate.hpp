@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/table/statistics_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class BaseStatistics;
+
+enum class StatisticsAggregateType : uint8_t { COUNT_STAR, COUNT, MIN, MAX };
+
+//! An ungrouped aggregate over a column of a table that can be computed from the statistics of a row group
+struct StatisticsAggregate {
+	StatisticsAggregate(StatisticsAggregateType type, storage_t column_index, LogicalType column_type);
+
+	StatisticsAggregateType type;
+	//! The storage index of the aggregated column (unused for COUNT_STAR)
+	storage_t column_index;
+	//! The type of the aggregated column
+	LogicalType column_type;
+
+public:
+	//! Whether or not the aggregate can be computed from the statistics of a column of the given type
+	static bool SupportsType(StatisticsAggregateType type, const LogicalType &column_type);
+};
+
+//! StatisticsAggregateState holds the results of a set of ungrouped aggregates over the row groups that a table scan
+//! answered from their statistics instead of scanning them. The aggregate operator above the scan combines the
+//! results with the aggregates over the rows that were scanned.
+class StatisticsAggregateState {
+public:
+	explicit StatisticsAggregateState(vector<StatisticsAggregate> aggregates);
+
+	//! The aggregates
+	vector<StatisticsAggregate> aggregates;
+
+public:
+	//! Clears the results - called once at the start of every scan
+	void Reset();
+	//! Computes the contribution of a row group with the given row count and column statistics to the aggregates.
+	//! The statistics must be exact (i.e. not widened by updates or deletes). Returns false if (and only if) any of the
+	//! aggregates cannot be computed from the statistics, in which case the row group has to be scanned.
+	bool ComputeRowGroup(idx_t count, const vector<unique_ptr<BaseStatistics>> &stats, vector<Value> &result) const;
+	//! Adds the contribution of a row group, as computed by ComputeRowGroup
+	void Combine(const vector<Value> &row_group);
+	//! Returns the result of the aggregate at the given index: the row count for COUNT and COUNT_STAR and the
+	//! minimum/maximum value (or NULL if there were no non-NULL values) for MIN and MAX
+	Value GetResult(idx_t aggregate_idx);
+
+private:
+	mutex lock;
+	//! The results of the aggregates
+	vector<Value> results;
+};
+
+} // namespace duckdb
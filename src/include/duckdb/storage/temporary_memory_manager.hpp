@@ -24,7 +24,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -52,6 +53,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client whose query this state belongs to
+	ClientContext &context;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -98,10 +101,12 @@ private:
 	unique_lock<mutex> Lock();
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
-	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
+	//! Update memory_limit, has_temporary_directory, num_threads and query_max_memory (must hold the lock)
 	void UpdateConfiguration(ClientContext &context);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
 	void UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state);
+	//! Get the sum of reservations of the other states of the same query (must hold the lock)
+	idx_t GetQueryReservation(const TemporaryMemoryState &temporary_memory_state) const;
 	//! Set the remaining size of a TemporaryMemoryState (must hold the lock)
 	void SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size);
 	//! Set the reservation of a TemporaryMemoryState (must hold the lock)
@@ -122,7 +127,7 @@ private:
 	bool has_temporary_directory = false;
 	//! Number of threads
 	idx_t num_threads = DConstants::INVALID_INDEX;
-	//! Max memory per query
+	//! Max memory per query of the client that last updated the configuration
 	idx_t query_max_memory = DConstants::INVALID_INDEX;
 
 	//! Currently active states
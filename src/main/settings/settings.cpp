@@ -1408,6 +1408,37 @@ Value PerfectHashThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).perfect_ht_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	if (param == "on" || param == "true") {
+		config.options.pin_threads = ThreadPinMode::ON;
+	} else if (param == "off" || param == "false") {
+		config.options.pin_threads = ThreadPinMode::OFF;
+	} else if (param == "auto") {
+		config.options.pin_threads = ThreadPinMode::AUTO;
+	} else {
+		throw ParserException("Unrecognized option for PRAGMA pin_threads, expected on, off or auto");
+	}
+	if (db) {
+		TaskScheduler::GetScheduler(*db).RelaunchThreads();
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).RelaunchThreads();
+	}
+}
+
+Value PinThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.pin_threads)));
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1593,6 +1624,59 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto query_memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+	if (query_memory_limit == NumericLimits<idx_t>::Maximum()) {
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(query_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Scheduler Max Threads
+//===--------------------------------------------------------------------===//
+void SchedulerMaxThreadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scheduler_max_threads = ClientConfig().scheduler_max_threads;
+}
+
+void SchedulerMaxThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).scheduler_max_threads = input.GetValue<uint64_t>();
+}
+
+Value SchedulerMaxThreadsSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).scheduler_max_threads);
+}
+
+//===--------------------------------------------------------------------===//
+// Scheduler Weight
+//===--------------------------------------------------------------------===//
+void SchedulerWeightSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scheduler_weight = ClientConfig().scheduler_weight;
+}
+
+void SchedulerWeightSetting::SetLocal(ClientContext &context, const Value &input) {
+	const auto param = input.GetValue<uint64_t>();
+	if (param == 0) {
+		throw ParserException("Invalid option for PRAGMA scheduler_weight, value must be positive");
+	}
+	ClientConfig::GetConfig(context).scheduler_weight = param;
+}
+
+Value SchedulerWeightSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).scheduler_weight);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1650,6 +1734,21 @@ Value SecretDirectorySetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Statement Timeout
+//===--------------------------------------------------------------------===//
+void StatementTimeoutSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).statement_timeout = ClientConfig().statement_timeout;
+}
+
+void StatementTimeoutSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).statement_timeout = input.GetValue<uint64_t>();
+}
+
+Value StatementTimeoutSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).statement_timeout);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -37,6 +37,7 @@ void CommonSubExpressionOptimizer::VisitOperator(LogicalOperator &op) {
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_PROJECTION:
 	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		ExtractFilterSubExpressions(op);
 		ExtractCommonSubExpresions(op);
 		break;
 	default:
@@ -121,6 +122,46 @@ void CommonSubExpressionOptimizer::PerformCSEReplacement(unique_ptr<Expression>
 	                                      [&](unique_ptr<Expression> &child) { PerformCSEReplacement(child, state); });
 }
 
+void CommonSubExpressionOptimizer::ExtractFilterSubExpressions(LogicalOperator &op) {
+	D_ASSERT(op.children.size() == 1);
+	if (op.children[0]->type != LogicalOperatorType::LOGICAL_FILTER) {
+		return;
+	}
+	auto &filter = op.children[0]->Cast<LogicalFilter>();
+	if (!filter.projection_map.empty() || filter.expressions.size() != 1) {
+		// the filter has to pass through the bindings of its child, and evaluate its expression for every tuple
+		return;
+	}
+
+	// count the expressions of the filter and of the operator separately
+	CSEReplacementState filter_state;
+	CountExpressions(*filter.expressions[0], filter_state);
+	CSEReplacementState op_state;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { CountExpressions(**child, op_state); });
+
+	// the filter evaluates its expressions for every tuple anyway, so the expressions it shares with the operator can
+	// be computed once in a projection below the filter without doing any extra work
+	CSEReplacementState state;
+	for (auto &entry : filter_state.expression_count) {
+		if (op_state.expression_count.find(entry.first) != op_state.expression_count.end()) {
+			state.expression_count[entry.first].count = 2;
+		}
+	}
+	if (state.expression_count.empty()) {
+		return;
+	}
+	state.projection_index = binder.GenerateTableIndex();
+	PerformCSEReplacement(filter.expressions[0], state);
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { PerformCSEReplacement(*child, state); });
+	D_ASSERT(state.expressions.size() > 0);
+	// create a projection node as the child of the filter
+	auto projection = make_uniq<LogicalProjection>(state.projection_index, std::move(state.expressions));
+	projection->children.push_back(std::move(filter.children[0]));
+	filter.children[0] = std::move(projection);
+}
+
 void CommonSubExpressionOptimizer::ExtractCommonSubExpresions(LogicalOperator &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -1,8 +1,11 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -32,6 +35,66 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// the rows that do not beat the current boundary of the first order can be skipped by the scan
+	// only column references that sort NULLs last can be turned into a simple comparison
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return;
+	}
+	auto &type = order.expression->return_type;
+	if (type.IsNested() || type.id() == LogicalTypeId::INTERVAL) {
+		// nested columns and intervals are not supported for pushdown
+		return;
+	}
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+
+	// find the child LogicalGet (if possible)
+	reference<LogicalOperator> child(*op.children[0]);
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &child_op = child.get();
+		switch (child_op.type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			// filters only remove rows, so the boundary still holds
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child_op.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				// not a simple column ref - bail-out
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			break;
+		}
+		default:
+			return;
+		}
+		child = *child_op.children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.function.filter_pushdown || binding.table_index != get.table_index) {
+		return;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (binding.column_index >= column_ids.size() || IsRowIdColumnId(column_ids[binding.column_index])) {
+		return;
+	}
+
+	// set up the dynamic filters (if we don't have any yet)
+	if (!get.dynamic_filters) {
+		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	op.dynamic_filters = get.dynamic_filters;
+	op.dynamic_filter_column = binding.column_index;
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -62,6 +125,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
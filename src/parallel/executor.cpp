@@ -391,7 +391,13 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(context);
+
+		auto statement_timeout = ClientConfig::GetConfig(context).statement_timeout;
+		has_deadline = statement_timeout > 0;
+		if (has_deadline) {
+			deadline = steady_clock::now() + milliseconds(statement_timeout);
+		}
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -558,6 +564,12 @@ PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 			current_task = task.get();
 		}
 
+		if (!HasError() && StatementTimeoutExpired()) {
+			// the tasks of this query might all be blocked or waiting for a thread, so we check the timeout here too
+			PushError(ErrorData(ExceptionType::INTERRUPT, StatementTimeoutMessage()));
+			current_task = nullptr;
+		}
+
 		if (!current_task && !HasError()) {
 			// there are no tasks to be scheduled and there are tasks blocked
 			lock_guard<mutex> l(executor_lock);
@@ -612,6 +624,7 @@ void Executor::Reset() {
 	lock_guard<mutex> elock(executor_lock);
 	physical_plan = nullptr;
 	cancelled = false;
+	has_deadline = false;
 	owned_plan.reset();
 	root_executor.reset();
 	root_pipelines.clear();
@@ -625,6 +638,21 @@ void Executor::Reset() {
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
 }
 
+bool Executor::StatementTimeoutExpired() const {
+	return has_deadline && steady_clock::now() >= deadline;
+}
+
+string Executor::StatementTimeoutMessage() const {
+	return StringUtil::Format("Query exceeded the statement_timeout of %llu ms",
+	                          ClientConfig::GetConfig(context).statement_timeout);
+}
+
+void Executor::CheckStatementTimeout() const {
+	if (StatementTimeoutExpired()) {
+		throw InterruptException(StatementTimeoutMessage());
+	}
+}
+
 shared_ptr<Pipeline> Executor::CreateChildPipeline(Pipeline &current, PhysicalOperator &op) {
 	D_ASSERT(!current.operators.empty());
 	D_ASSERT(op.IsSource());
@@ -171,6 +171,7 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 		if (context.client.interrupted) {
 			throw InterruptException();
 		}
+		pipeline.executor.CheckStatementTimeout();
 
 		OperatorResultType result;
 		if (exhausted_source && done_flushing && !remaining_sink_chunk && !next_batch_blocked &&
@@ -7,7 +7,9 @@ TaskExecutor::TaskExecutor(TaskScheduler &scheduler)
     : scheduler(scheduler), token(scheduler.CreateProducer()), completed_tasks(0), total_tasks(0) {
 }
 
-TaskExecutor::TaskExecutor(ClientContext &context) : TaskExecutor(TaskScheduler::GetScheduler(context)) {
+TaskExecutor::TaskExecutor(ClientContext &context)
+    : scheduler(TaskScheduler::GetScheduler(context)), token(scheduler.CreateProducer(context)), completed_tasks(0),
+      total_tasks(0) {
 }
 
 TaskExecutor::~TaskExecutor() {
@@ -2,7 +2,9 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -23,6 +25,10 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -42,8 +48,8 @@ struct ConcurrentQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerState &producer, shared_ptr<Task> task);
+	bool DequeueFromProducer(ProducerState &producer, shared_ptr<Task> &task);
 };
 
 struct QueueProducerToken {
@@ -53,39 +59,84 @@ struct QueueProducerToken {
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+#else
+struct ConcurrentQueue {
+	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
+	mutex qlock;
+
+	void Enqueue(ProducerState &producer, shared_ptr<Task> task);
+	bool DequeueFromProducer(ProducerState &producer, shared_ptr<Task> &task);
+};
+
+struct QueueProducerToken {
+	explicit QueueProducerToken(ConcurrentQueue &queue) : queue(&queue) {
+	}
+
+	~QueueProducerToken() {
+		lock_guard<mutex> lock(queue->qlock);
+		queue->q.erase(*this);
+	}
+
+private:
+	ConcurrentQueue *queue;
+};
+#endif
+
+struct ProducerState {
+	ProducerState(unique_ptr<QueueProducerToken> token, idx_t weight, idx_t max_threads)
+	    : token(std::move(token)), weight(MaxValue<idx_t>(weight, 1)), max_threads(max_threads), queued_tasks(0),
+	      active_tasks(0), deficit(0) {
+	}
+
+	//! Fetches a task of this producer for a worker thread, unless the producer is at its thread limit
+	bool TryDequeue(ConcurrentQueue &queue, shared_ptr<Task> &task);
+
+	unique_ptr<QueueProducerToken> token;
+	mutex producer_lock;
+	//! The share of the worker threads this producer receives relative to other producers
+	const idx_t weight;
+	//! The maximum number of tasks of this producer that worker threads execute concurrently (0 = no limit)
+	const idx_t max_threads;
+	//! The number of tasks of this producer that are in the queue
+	atomic<idx_t> queued_tasks;
+	//! The number of tasks of this producer that are being executed by worker threads
+	atomic<idx_t> active_tasks;
+	//! The number of tasks handed out since it became the turn of this producer
+	atomic<idx_t> deficit;
+};
+
+//! The producers a worker thread chooses its tasks from
+struct ProducerSnapshot {
+	//! The version of the producer list this is a copy of
+	idx_t version = DConstants::INVALID_INDEX;
+	shared_ptr<vector<shared_ptr<ProducerState>>> producers;
+};
+
+#ifndef DUCKDB_NO_THREADS
+void ConcurrentQueue::Enqueue(ProducerState &producer, shared_ptr<Task> task) {
+	lock_guard<mutex> producer_lock(producer.producer_lock);
+	if (q.enqueue(producer.token->queue_token, std::move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+bool ConcurrentQueue::DequeueFromProducer(ProducerState &producer, shared_ptr<Task> &task) {
+	lock_guard<mutex> producer_lock(producer.producer_lock);
+	return q.try_dequeue_from_producer(producer.token->queue_token, task);
 }
-
 #else
-struct ConcurrentQueue {
-	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
-	mutex qlock;
-
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
-};
-
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerState &producer, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
-	q[std::ref(*token.token)].push(std::move(task));
+	q[std::ref(*producer.token)].push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerState &producer, shared_ptr<Task> &task) {
 	lock_guard<mutex> lock(qlock);
 	D_ASSERT(!q.empty());
 
-	const auto it = q.find(std::ref(*token.token));
+	const auto it = q.find(std::ref(*producer.token));
 	if (it == q.end() || it->second.empty()) {
 		return false;
 	}
@@ -95,34 +146,41 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 
 	return true;
 }
+#endif
 
-struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue(&queue) {
+bool ProducerState::TryDequeue(ConcurrentQueue &queue, shared_ptr<Task> &task) {
+	if (queued_tasks.load() == 0) {
+		return false;
 	}
-
-	~QueueProducerToken() {
-		lock_guard<mutex> lock(queue->qlock);
-		queue->q.erase(*this);
+	// claim a thread slot first, so concurrent workers cannot exceed the thread limit together
+	if (++active_tasks > max_threads && max_threads > 0) {
+		active_tasks--;
+		return false;
 	}
+	if (!queue.DequeueFromProducer(*this, task)) {
+		active_tasks--;
+		return false;
+	}
+	queued_tasks--;
+	return true;
+}
 
-private:
-	ConcurrentQueue *queue;
-};
-#endif
-
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, shared_ptr<ProducerState> state)
+    : scheduler(scheduler), state(std::move(state)) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.RemoveProducer(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), thread_pin_mode(ThreadPinMode::OFF),
+      producers(make_shared_ptr<vector<shared_ptr<ProducerState>>>()), producers_version(0), next_producer(0) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
+	orphan_producer = CreateProducer();
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -144,17 +202,109 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 }
 
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
+	return CreateProducer(1, 0);
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return CreateProducer(config.scheduler_weight, config.scheduler_max_threads);
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(idx_t weight, idx_t max_threads) {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	auto state = make_shared_ptr<ProducerState>(std::move(token), weight, max_threads);
+
+	lock_guard<mutex> guard(producer_lock);
+	auto new_producers = make_shared_ptr<vector<shared_ptr<ProducerState>>>(*producers);
+	new_producers->push_back(state);
+	producers = std::move(new_producers);
+	producers_version++;
+	return make_uniq<ProducerToken>(*this, std::move(state));
+}
+
+void TaskScheduler::RemoveProducer(ProducerToken &producer) {
+	{
+		lock_guard<mutex> guard(producer_lock);
+		auto new_producers = make_shared_ptr<vector<shared_ptr<ProducerState>>>();
+		for (auto &state : *producers) {
+			if (!RefersToSameObject(*state, *producer.state)) {
+				new_producers->push_back(state);
+			}
+		}
+		producers = std::move(new_producers);
+		producers_version++;
+	}
+	if (!orphan_producer || RefersToSameObject(producer, *orphan_producer)) {
+		return;
+	}
+	// hand over any tasks that are left so they still get executed by the worker threads
+	shared_ptr<Task> task;
+	while (GetTaskFromProducer(producer, task)) {
+		ScheduleTask(*orphan_producer, std::move(task));
+	}
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	token.state->queued_tasks++;
+	queue->Enqueue(*token.state, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (!queue->DequeueFromProducer(*token.state, task)) {
+		return false;
+	}
+	token.state->queued_tasks--;
+	return true;
+}
+
+void TaskScheduler::RefreshProducers(ProducerSnapshot &snapshot) {
+	if (snapshot.version == producers_version.load()) {
+		return;
+	}
+	lock_guard<mutex> guard(producer_lock);
+	snapshot.producers = producers;
+	snapshot.version = producers_version.load();
+}
+
+bool TaskScheduler::DequeueTask(ProducerSnapshot &snapshot, shared_ptr<Task> &task,
+                                optional_ptr<ProducerState> &producer) {
+	RefreshProducers(snapshot);
+	auto &candidates = *snapshot.producers;
+	const auto count = candidates.size();
+	// deficit round-robin: every producer can hand out "weight" tasks before it is the next producer's turn
+	for (idx_t i = 0; i < count; i++) {
+		auto position = next_producer.load();
+		auto &candidate = *candidates[position % count];
+		if (candidate.TryDequeue(*queue, task)) {
+			if (++candidate.deficit >= candidate.weight) {
+				candidate.deficit = 0;
+				next_producer.compare_exchange_strong(position, position + 1);
+			}
+			producer = candidate;
+			return true;
+		}
+		// producers without runnable tasks do not build up credit
+		candidate.deficit = 0;
+		next_producer.compare_exchange_strong(position, position + 1);
+	}
+	// other threads may have moved the round-robin along while we were looking - make sure we do not go back to
+	// sleep on the signal of a task that is still queued
+	for (auto &candidate : candidates) {
+		if (candidate->TryDequeue(*queue, task)) {
+			producer = *candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+void TaskScheduler::FinishTask(ProducerState &producer) {
+	producer.active_tasks--;
+	if (producer.max_threads > 0 && producer.queued_tasks > 0) {
+		// threads that skipped this producer because of its thread limit have consumed the signal of its tasks
+		Signal(1);
+	}
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
@@ -162,6 +312,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	ProducerSnapshot snapshot;
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush() || allocator_background_threads) {
@@ -177,7 +328,8 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		optional_ptr<ProducerState> producer;
+		if (DequeueTask(snapshot, task, producer)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -192,6 +344,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				task.reset();
 				break;
 			}
+			FinishTask(*producer);
 		}
 	}
 	// this thread will exit, flush all of its outstanding allocations
@@ -207,10 +360,12 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	ProducerSnapshot snapshot;
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		optional_ptr<ProducerState> producer;
+		if (!DequeueTask(snapshot, task, producer)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -228,6 +383,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 			task.reset();
 			break;
 		}
+		FinishTask(*producer);
 	}
 	return completed_tasks;
 #else
@@ -238,9 +394,11 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	ProducerSnapshot snapshot;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		optional_ptr<ProducerState> producer;
+		if (!DequeueTask(snapshot, task, producer)) {
 			return;
 		}
 		try {
@@ -258,8 +416,10 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 				break;
 			}
 		} catch (...) {
+			FinishTask(*producer);
 			return;
 		}
+		FinishTask(*producer);
 	}
 #else
 	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
@@ -270,6 +430,143 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
 	scheduler->ExecuteForever(marker);
 }
+
+#if defined(__linux__)
+static bool ReadSystemFile(FileSystem &fs, const string &path, string &result) {
+	if (!fs.FileExists(path)) {
+		return false;
+	}
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	char buffer[4096];
+	auto bytes_read = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+	if (bytes_read <= 0) {
+		return false;
+	}
+	result = string(buffer, NumericCast<idx_t>(bytes_read));
+	return true;
+}
+
+//! Parses a sysfs CPU list, e.g. "0-3,8-11"
+static vector<int> ParseCPUList(const string &list) {
+	vector<int> result;
+	for (auto &range : StringUtil::Split(StringUtil::Replace(list, "\n", ""), ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		if (bounds.empty() || bounds.size() > 2) {
+			continue;
+		}
+		auto start = std::stoi(bounds[0]);
+		auto end = bounds.size() == 2 ? std::stoi(bounds[1]) : start;
+		for (int cpu = start; cpu <= end && cpu < CPU_SETSIZE; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+//! Returns the CPUs of the NUMA nodes the process may run on. Within a node, the first hardware thread of every
+//! physical core comes before the remaining (hyper-)threads of the cores.
+static vector<vector<int>> GetNodeCores(const cpu_set_t &allowed) {
+	auto fs = FileSystem::CreateLocal();
+	vector<idx_t> node_ids;
+	fs->ListFiles("/sys/devices/system/node", [&](const string &name, bool is_directory) {
+		if (is_directory && StringUtil::StartsWith(name, "node") && name.size() > 4 &&
+		    StringUtil::CharacterIsDigit(name[4])) {
+			node_ids.push_back(std::stoull(name.substr(4)));
+		}
+	});
+	std::sort(node_ids.begin(), node_ids.end());
+
+	vector<vector<int>> node_cpus;
+	for (auto node_id : node_ids) {
+		string cpu_list;
+		if (!ReadSystemFile(*fs, StringUtil::Format("/sys/devices/system/node/node%llu/cpulist", node_id), cpu_list)) {
+			continue;
+		}
+		vector<int> cpus;
+		for (auto cpu : ParseCPUList(cpu_list)) {
+			if (CPU_ISSET(cpu, &allowed)) {
+				cpus.push_back(cpu);
+			}
+		}
+		if (!cpus.empty()) {
+			node_cpus.push_back(std::move(cpus));
+		}
+	}
+	if (node_cpus.empty()) {
+		// no NUMA information: all allowed CPUs are on the same node
+		node_cpus.emplace_back();
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &allowed)) {
+				node_cpus.back().push_back(cpu);
+			}
+		}
+	}
+
+	for (auto &cpus : node_cpus) {
+		vector<int> first_threads;
+		vector<int> sibling_threads;
+		for (auto cpu : cpus) {
+			auto sibling_path = StringUtil::Format("/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+			string sibling_list;
+			bool is_first = true;
+			if (ReadSystemFile(*fs, sibling_path, sibling_list)) {
+				for (auto sibling : ParseCPUList(sibling_list)) {
+					if (sibling < cpu && CPU_ISSET(sibling, &allowed)) {
+						is_first = false;
+						break;
+					}
+				}
+			}
+			(is_first ? first_threads : sibling_threads).push_back(cpu);
+		}
+		cpus = std::move(first_threads);
+		cpus.insert(cpus.end(), sibling_threads.begin(), sibling_threads.end());
+	}
+	return node_cpus;
+}
+#endif
+
+//! Pins the worker threads to their own core, or lets them float across all cores again. Consecutive threads are
+//! spread across the NUMA nodes the process may run on, and over the physical cores of a node before their
+//! hyper-threads. Memory that is first touched by a thread then stays on the NUMA node of its core.
+static void SetThreadAffinity(vector<unique_ptr<SchedulerThread>> &threads, ThreadPinMode mode) {
+#if defined(__linux__)
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0) {
+		return;
+	}
+	vector<int> cores;
+	if (mode != ThreadPinMode::OFF) {
+		auto node_cores = GetNodeCores(allowed);
+		if (mode == ThreadPinMode::ON || node_cores.size() > 1) {
+			// take the cores of the nodes in turns
+			for (idx_t core_idx = 0;; core_idx++) {
+				auto core_count = cores.size();
+				for (auto &node : node_cores) {
+					if (core_idx < node.size()) {
+						cores.push_back(node[core_idx]);
+					}
+				}
+				if (cores.size() == core_count) {
+					break;
+				}
+			}
+		}
+	}
+	for (idx_t i = 0; i < threads.size(); i++) {
+		cpu_set_t cpuset;
+		if (!cores.empty()) {
+			CPU_ZERO(&cpuset);
+			CPU_SET(cores[i % cores.size()], &cpuset);
+		} else {
+			cpuset = allowed;
+		}
+		// pinning is best-effort: if it fails the thread keeps running wherever the OS schedules it
+		pthread_setaffinity_np(threads[i]->internal_thread->native_handle(), sizeof(cpu_set_t), &cpuset);
+	}
+#endif
+}
 #endif
 
 int32_t TaskScheduler::NumberOfThreads() {
@@ -354,6 +651,10 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 	auto &config = DBConfig::GetConfig(db);
 	auto new_thread_count = NumericCast<idx_t>(n);
 	if (threads.size() == new_thread_count) {
+		if (thread_pin_mode != config.options.pin_threads) {
+			thread_pin_mode = config.options.pin_threads;
+			SetThreadAffinity(threads, thread_pin_mode);
+		}
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
@@ -391,6 +692,8 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 			markers.push_back(std::move(marker));
 		}
 	}
+	thread_pin_mode = config.options.pin_threads;
+	SetThreadAffinity(threads, thread_pin_mode);
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 	if (Allocator::SupportsFlush()) {
 		Allocator::FlushAll();
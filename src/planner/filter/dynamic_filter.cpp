@@ -0,0 +1,67 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> l(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	return column_name + " DYNAMIC_FILTER";
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	if (filter_data) {
+		lock_guard<mutex> l(filter_data->lock);
+		if (filter_data->initialized) {
+			return filter_data->filter->ToExpression(column);
+		}
+	}
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// Copies share the filter data, so they see updates
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+void DynamicFilterData::SetValue(ExpressionType comparison_type, Value val) {
+	if (val.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> l(lock);
+	filter = make_uniq<ConstantFilter>(comparison_type, std::move(val));
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> l(lock);
+	filter.reset();
+	initialized = false;
+}
+
+} // namespace duckdb
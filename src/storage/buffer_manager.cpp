@@ -3,6 +3,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_buffer.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
@@ -64,6 +65,10 @@ idx_t BufferManager::GetQueryMaxMemory() const {
 	return GetBufferPool().GetQueryMaxMemory();
 }
 
+idx_t BufferManager::GetQueryMaxMemory(ClientContext &context) const {
+	return MinValue<idx_t>(GetQueryMaxMemory(), ClientConfig::GetConfig(context).query_memory_limit);
+}
+
 unique_ptr<FileBuffer> BufferManager::ConstructManagedBuffer(idx_t size, unique_ptr<FileBuffer> &&,
                                                              FileBufferType type) {
 	throw NotImplementedException("This type of BufferManager can not construct managed buffers");
@@ -878,6 +878,20 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 
 template <class T>
 void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	if (scan_count == STANDARD_VECTOR_SIZE) {
+		if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		// If we are scanning an entire Vector that falls within a single constant group, emit a ConstantVector
+		if (scan_state.current_group.mode == BitpackingMode::CONSTANT &&
+		    BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset >= scan_count) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			*ConstantVector::GetData<T>(result) = scan_state.current_constant;
+			scan_state.current_group_offset += scan_count;
+			return;
+		}
+	}
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
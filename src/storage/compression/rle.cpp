@@ -117,6 +117,8 @@ idx_t RLEFinalAnalyze(AnalyzeState &state) {
 //===--------------------------------------------------------------------===//
 struct RLEConstants {
 	static constexpr const idx_t RLE_HEADER_SIZE = sizeof(uint64_t);
+	//! The minimum average run length for which a scan emits the runs as a dictionary vector
+	static constexpr const idx_t MIN_DICTIONARY_RUN_LENGTH = 8;
 };
 
 template <class T, bool WRITE_STATISTICS>
@@ -335,6 +337,52 @@ static void RLEScanConstant(RLEScanState<T> &scan_state, rle_count_t *index_poin
 	return;
 }
 
+//! Counts the number of runs that the next scan_count rows span
+template <class T>
+static idx_t RLECountRuns(RLEScanState<T> &scan_state, rle_count_t *index_pointer, idx_t scan_count) {
+	idx_t run_count = 0;
+	idx_t entry_pos = scan_state.entry_pos;
+	idx_t position_in_entry = scan_state.position_in_entry;
+	idx_t remaining = scan_count;
+	while (remaining > 0) {
+		auto in_run = MinValue<idx_t>(remaining, index_pointer[entry_pos] - position_in_entry);
+		remaining -= in_run;
+		position_in_entry = 0;
+		entry_pos++;
+		run_count++;
+	}
+	return run_count;
+}
+
+//! Emits the runs as a dictionary vector: the dictionary holds the value of every run, and the selection vector
+//! points every row to its run. Operators can then process every run once instead of every row.
+template <class T>
+static void RLEScanDictionary(RLEScanState<T> &scan_state, rle_count_t *index_pointer, T *data_pointer,
+                              idx_t scan_count, idx_t run_count, Vector &result) {
+	Vector dictionary(result.GetType(), run_count);
+	auto dictionary_data = FlatVector::GetData<T>(dictionary);
+	SelectionVector sel(scan_count);
+	idx_t run_idx = 0;
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto in_run = MinValue<idx_t>(scan_count - scanned,
+		                              index_pointer[scan_state.entry_pos] - scan_state.position_in_entry);
+		dictionary_data[run_idx] = data_pointer[scan_state.entry_pos];
+		for (idx_t i = 0; i < in_run; i++) {
+			sel.set_index(scanned + i, run_idx);
+		}
+		scanned += in_run;
+		scan_state.position_in_entry += in_run;
+		if (ExhaustedRun(scan_state, index_pointer)) {
+			ForwardToNextRun(scan_state);
+		}
+		run_idx++;
+	}
+	D_ASSERT(run_idx == run_count);
+	result.Slice(dictionary, sel, scan_count);
+	DictionaryVector::SetDictionarySize(result, run_count);
+}
+
 template <class T, bool ENTIRE_VECTOR>
 void RLEScanPartialInternal(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
                             idx_t result_offset) {
@@ -350,6 +398,14 @@ void RLEScanPartialInternal(ColumnSegment &segment, ColumnScanState &state, idx_
 		RLEScanConstant<T>(scan_state, index_pointer, data_pointer, scan_count, result);
 		return;
 	}
+	if (ENTIRE_VECTOR && scan_count == STANDARD_VECTOR_SIZE) {
+		// If the runs are long enough, emit them as a dictionary
+		auto run_count = RLECountRuns<T>(scan_state, index_pointer, scan_count);
+		if (run_count * RLEConstants::MIN_DICTIONARY_RUN_LENGTH <= scan_count) {
+			RLEScanDictionary<T>(scan_state, index_pointer, data_pointer, scan_count, run_count, result);
+			return;
+		}
+	}
 
 	auto result_data = FlatVector::GetData<T>(result);
 	result.SetVectorType(VectorType::FLAT_VECTOR);
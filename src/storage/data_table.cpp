@@ -245,7 +245,8 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = Storage::ROW_GROUP_VECTOR_COUNT;
+	// the tail of the scan is split up into smaller morsels, so more threads than row groups can participate
+	idx_t parallel_scan_vector_count = Storage::MIN_PARALLEL_SCAN_VECTOR_COUNT;
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
 		parallel_scan_vector_count = 1;
 	}
@@ -194,6 +194,7 @@ struct ArrayColumnCheckpointState : public ColumnCheckpointState {
 public:
 	unique_ptr<BaseStatistics> GetStatistics() override {
 		auto stats = global_stats->Copy();
+		stats.Merge(*validity_state->GetStatistics());
 		ArrayStats::SetChildStats(stats, child_state->GetStatistics());
 		return stats.ToUnique();
 	}
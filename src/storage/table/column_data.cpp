@@ -138,11 +138,18 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
 	}
 	state.previous_states.clear();
+	if (state.initialized && state.transient_segment &&
+	    state.current->segment_type == ColumnSegmentType::PERSISTENT) {
+		// the segment was written to disk while we were scanning it (e.g. by an optimistic write to the table we are
+		// scanning) - this can move its data to a different block, so we need to re-initialize the scan
+		state.initialized = false;
+	}
 	if (!state.initialized) {
 		D_ASSERT(state.current);
 		state.current->InitializeScan(state);
 		state.internal_index = state.current->start;
 		state.initialized = true;
+		state.transient_segment = state.current->segment_type == ColumnSegmentType::TRANSIENT;
 	}
 	D_ASSERT(data.HasSegment(state.current));
 	D_ASSERT(state.internal_index <= state.row_index);
@@ -294,10 +301,49 @@ idx_t ColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t scan_c
 	return ScanVector(state, result, scan_count, ScanVectorType::SCAN_FLAT_VECTOR);
 }
 
+//! Applies a filter to a dictionary vector of a known size by evaluating it once for every dictionary entry
+static void DictionarySelect(Vector &result, SelectionVector &sel, idx_t &s_count, const TableFilter &filter,
+                             idx_t dictionary_size) {
+	auto &dictionary = DictionaryVector::Child(result);
+	SelectionVector dictionary_sel(dictionary_size);
+	for (idx_t i = 0; i < dictionary_size; i++) {
+		dictionary_sel.set_index(i, i);
+	}
+	idx_t approved_entries = dictionary_size;
+	UnifiedVectorFormat ddata;
+	dictionary.ToUnifiedFormat(dictionary_size, ddata);
+	ColumnSegment::FilterSelection(dictionary_sel, dictionary, ddata, filter, dictionary_size, approved_entries);
+
+	ValidityMask entry_passes(dictionary_size);
+	entry_passes.SetAllInvalid(dictionary_size);
+	for (idx_t i = 0; i < approved_entries; i++) {
+		entry_passes.SetValid(dictionary_sel.get_index(i));
+	}
+	// now select the rows that point to an entry that passed the filter
+	auto &entries = DictionaryVector::SelVector(result);
+	SelectionVector new_sel(s_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < s_count; i++) {
+		auto idx = sel.get_index(i);
+		if (entry_passes.RowIsValid(entries.get_index(idx))) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	s_count = result_count;
+}
+
 void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                         SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
 	idx_t scan_count = Scan(transaction, vector_index, state, result);
 
+	if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto dictionary_size = DictionaryVector::DictionarySize(result);
+		if (dictionary_size.IsValid() && dictionary_size.GetIndex() < s_count) {
+			DictionarySelect(result, sel, s_count, filter, dictionary_size.GetIndex());
+			return;
+		}
+	}
 	UnifiedVectorFormat vdata;
 	result.ToUnifiedFormat(scan_count, vdata);
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, s_count);
@@ -379,6 +425,14 @@ unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
 	return stats->statistics.ToUnique();
 }
 
+void ColumnData::SetStatistics(const BaseStatistics &other) {
+	if (!stats) {
+		throw InternalException("ColumnData::SetStatistics called on a column without stats");
+	}
+	lock_guard<mutex> l(stats_lock);
+	stats->statistics = other.Copy();
+}
+
 void ColumnData::MergeStatistics(const BaseStatistics &other) {
 	if (!stats) {
 		throw InternalException("ColumnData::MergeStatistics called on a column without stats");
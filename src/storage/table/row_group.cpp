@@ -16,6 +16,7 @@
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/row_version_manager.hpp"
+#include "duckdb/storage/table/statistics_aggregate.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
@@ -392,6 +393,43 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 	return true;
 }
 
+bool RowGroup::TryAggregateStatistics(ScanFilterInfo &filters, StatisticsAggregateState &state) {
+	if (HasUnloadedDeletes()) {
+		return false;
+	}
+	auto vinfo = GetVersionInfo();
+	if (vinfo && vinfo->HasChunkInfo()) {
+		// not all rows in the row group are visible to every transaction
+		return false;
+	}
+	// every row of the row group has to pass the filters
+	for (auto &entry : filters.GetFilterList()) {
+		auto prune_result = GetColumn(entry.table_column_index).CheckZonemap(entry.filter);
+		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			return false;
+		}
+	}
+	vector<unique_ptr<BaseStatistics>> stats;
+	for (auto &aggregate : state.aggregates) {
+		if (aggregate.type == StatisticsAggregateType::COUNT_STAR) {
+			stats.push_back(nullptr);
+			continue;
+		}
+		auto &column = GetColumn(aggregate.column_index);
+		if (!column.IsPersistent() || column.HasUpdates()) {
+			// appends and updates widen the statistics - they are no longer exact
+			return false;
+		}
+		stats.push_back(column.GetStatistics());
+	}
+	vector<Value> result;
+	if (!state.ComputeRowGroup(count, stats, result)) {
+		return false;
+	}
+	state.Combine(result);
+	return true;
+}
+
 static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	switch (filter.filter_type) {
 	case TableFilterType::STRUCT_EXTRACT: {
@@ -419,6 +457,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -555,14 +594,12 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 				sel.Initialize(nullptr);
 			}
 			//! first, we scan the columns with filters, fetch their data and generate a selection vector.
-			//! get runtime statistics
-			auto adaptive_filter = filter_info.GetAdaptiveFilter();
-			auto filter_state = filter_info.BeginFilter();
 			if (has_filters) {
 				D_ASSERT(ALLOW_UPDATES);
+				auto &adaptive_filter = *filter_info.GetAdaptiveFilter();
 				auto &filter_list = filter_info.GetFilterList();
 				for (idx_t i = 0; i < filter_list.size(); i++) {
-					auto filter_idx = adaptive_filter->permutation[i];
+					auto filter_idx = adaptive_filter.permutation[i];
 					auto &filter = filter_list[filter_idx];
 					if (filter.IsAlwaysTrue()) {
 						// this filter is always true - skip it
@@ -570,9 +607,15 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 					auto scan_idx = filter.scan_column_index;
 					auto &col_data = GetColumn(filter.table_column_index);
+					//! get runtime statistics
+					auto input_count = approved_tuple_count;
+					auto filter_state = adaptive_filter.BeginPredicate();
 					col_data.Select(transaction, state.vector_index, state.column_scans[scan_idx],
 					                result.data[scan_idx], sel, approved_tuple_count, filter.filter);
+					adaptive_filter.EndPredicate(filter_state, filter_idx, input_count,
+					                             input_count - approved_tuple_count);
 				}
+				adaptive_filter.EndFilter();
 				for (auto &table_filter : filter_list) {
 					if (table_filter.IsAlwaysTrue()) {
 						continue;
@@ -625,8 +668,6 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 				}
 			}
-			filter_info.EndFilter(filter_state);
-
 			D_ASSERT(approved_tuple_count > 0);
 			count = approved_tuple_count;
 		}
@@ -906,6 +947,9 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
+		// updates only ever widen the statistics of the column - now that they have been merged into the data we have
+		// just written, the statistics of that data are exact again
+		column.SetStatistics(*stats);
 
 		result.statistics.push_back(stats->Copy());
 		result.states.push_back(std::move(checkpoint_state));
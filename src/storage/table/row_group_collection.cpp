@@ -9,9 +9,11 @@
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table/statistics_aggregate.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
@@ -210,10 +212,29 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 					state.vector_index = 0;
 				}
 			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				auto &current = *state.current_row_group;
+				vector_index = state.vector_index;
+				auto row_group_vectors = (current.count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+				auto morsel_vectors = row_group_vectors - vector_index;
+				// near the end of the scan there is not enough work left to hand every thread a full row group
+				// split up the remaining rows so that idle threads can take over part of the last row groups
+				auto scan_position = current.start + vector_index * STANDARD_VECTOR_SIZE;
+				auto remaining_rows = state.max_row > scan_position ? state.max_row - scan_position : 0;
+				auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+				if (thread_count > 1 && remaining_rows < thread_count * Storage::ROW_GROUP_SIZE) {
+					auto thread_share =
+					    (remaining_rows / thread_count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+					thread_share = MaxValue<idx_t>(thread_share, Storage::MIN_PARALLEL_SCAN_VECTOR_COUNT);
+					morsel_vectors = MinValue<idx_t>(morsel_vectors, thread_share);
+				}
+				max_row = current.start +
+				          MinValue<idx_t>(current.count, (vector_index + morsel_vectors) * STANDARD_VECTOR_SIZE);
+				state.processed_rows += max_row - scan_position;
+				state.vector_index += morsel_vectors;
+				if (state.vector_index >= row_group_vectors) {
+					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+					state.vector_index = 0;
+				}
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -221,6 +242,14 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
 
+		auto statistics_aggregates = scan_state.GetOptions().statistics_aggregates;
+		if (statistics_aggregates && vector_index == 0 && row_group->start + row_group->count <= max_row) {
+			// we are scanning the entire row group - try to answer the aggregates over the scan from its statistics
+			if (row_group->TryAggregateStatistics(scan_state.GetFilterInfo(), *statistics_aggregates)) {
+				continue;
+			}
+		}
+
 		// initialize the scan for this row group
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
 		if (!need_to_scan) {
@@ -38,6 +38,16 @@ idx_t RowVersionManager::GetCommittedDeletedCount(idx_t count) {
 	return deleted_count;
 }
 
+bool RowVersionManager::HasChunkInfo() {
+	lock_guard<mutex> l(version_lock);
+	for (idx_t i = 0; i < Storage::ROW_GROUP_VECTOR_COUNT; i++) {
+		if (vector_info[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
 optional_ptr<ChunkInfo> RowVersionManager::GetChunkInfo(idx_t vector_idx) {
 	return vector_info[vector_idx].get();
 }
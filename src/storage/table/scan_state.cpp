@@ -95,20 +95,6 @@ optional_ptr<AdaptiveFilter> ScanFilterInfo::GetAdaptiveFilter() {
 	return adaptive_filter.get();
 }
 
-AdaptiveFilterState ScanFilterInfo::BeginFilter() const {
-	if (!adaptive_filter) {
-		return AdaptiveFilterState();
-	}
-	return adaptive_filter->BeginFilter();
-}
-
-void ScanFilterInfo::EndFilter(AdaptiveFilterState state) {
-	if (!adaptive_filter) {
-		return;
-	}
-	adaptive_filter->EndFilter(state);
-}
-
 void ColumnScanState::NextInternal(idx_t count) {
 	if (!current) {
 		//! There is no column segment
@@ -166,6 +166,8 @@ struct StandardColumnCheckpointState : public ColumnCheckpointState {
 public:
 	unique_ptr<BaseStatistics> GetStatistics() override {
 		D_ASSERT(global_stats);
+		// the null information is part of the statistics of the validity data
+		global_stats->Merge(*validity_state->GetStatistics());
 		return std::move(global_stats);
 	}
 
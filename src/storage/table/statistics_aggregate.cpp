@@ -0,0 +1,132 @@
+#include "duckdb/storage/table/statistics_aggregate.hpp"
+
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+StatisticsAggregate::StatisticsAggregate(StatisticsAggregateType type, storage_t column_index, LogicalType column_type)
+    : type(type), column_index(column_index), column_type(std::move(column_type)) {
+}
+
+bool StatisticsAggregate::SupportsType(StatisticsAggregateType type, const LogicalType &column_type) {
+	switch (type) {
+	case StatisticsAggregateType::COUNT_STAR:
+		return true;
+	case StatisticsAggregateType::COUNT:
+		// the validity of nested columns is tracked separately from the validity of their children
+		return !column_type.IsNested();
+	case StatisticsAggregateType::MIN:
+	case StatisticsAggregateType::MAX:
+		switch (column_type.id()) {
+		case LogicalTypeId::FLOAT:
+		case LogicalTypeId::DOUBLE:
+			// floating point statistics do not track NaN values
+		case LogicalTypeId::TIME_TZ:
+			// the statistics of TIME WITH TIME ZONE are not ordered in the same way as the values
+			return false;
+		default:
+			return column_type.IsNumeric() || column_type.IsTemporal();
+		}
+	default:
+		return false;
+	}
+}
+
+StatisticsAggregateState::StatisticsAggregateState(vector<StatisticsAggregate> aggregates_p)
+    : aggregates(std::move(aggregates_p)) {
+	Reset();
+}
+
+void StatisticsAggregateState::Reset() {
+	lock_guard<mutex> l(lock);
+	results.clear();
+	for (auto &aggregate : aggregates) {
+		switch (aggregate.type) {
+		case StatisticsAggregateType::COUNT_STAR:
+		case StatisticsAggregateType::COUNT:
+			results.push_back(Value::UBIGINT(0));
+			break;
+		default:
+			results.push_back(Value(aggregate.column_type));
+			break;
+		}
+	}
+}
+
+bool StatisticsAggregateState::ComputeRowGroup(idx_t count, const vector<unique_ptr<BaseStatistics>> &stats,
+                                               vector<Value> &result) const {
+	D_ASSERT(stats.size() == aggregates.size());
+	result.clear();
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i];
+		if (aggregate.type == StatisticsAggregateType::COUNT_STAR) {
+			result.push_back(Value::UBIGINT(count));
+			continue;
+		}
+		if (!stats[i]) {
+			return false;
+		}
+		auto &column_stats = *stats[i];
+		if (!column_stats.CanHaveNoNull()) {
+			// all values are NULL
+			result.push_back(aggregate.type == StatisticsAggregateType::COUNT ? Value::UBIGINT(0)
+			                                                                   : Value(aggregate.column_type));
+			continue;
+		}
+		switch (aggregate.type) {
+		case StatisticsAggregateType::COUNT:
+			if (column_stats.CanHaveNull()) {
+				// we only know whether there are NULL values, not how many
+				return false;
+			}
+			result.push_back(Value::UBIGINT(count));
+			break;
+		case StatisticsAggregateType::MIN:
+		case StatisticsAggregateType::MAX:
+			if (!NumericStats::HasMinMax(column_stats)) {
+				return false;
+			}
+			result.push_back(aggregate.type == StatisticsAggregateType::MIN ? NumericStats::Min(column_stats)
+			                                                                 : NumericStats::Max(column_stats));
+			break;
+		default:
+			throw InternalException("Unsupported StatisticsAggregateType");
+		}
+	}
+	return true;
+}
+
+void StatisticsAggregateState::Combine(const vector<Value> &row_group) {
+	D_ASSERT(row_group.size() == aggregates.size());
+	lock_guard<mutex> l(lock);
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &result = results[i];
+		auto &value = row_group[i];
+		switch (aggregates[i].type) {
+		case StatisticsAggregateType::COUNT_STAR:
+		case StatisticsAggregateType::COUNT:
+			result = Value::UBIGINT(result.GetValue<uint64_t>() + value.GetValue<uint64_t>());
+			break;
+		case StatisticsAggregateType::MIN:
+			if (!value.IsNull() && (result.IsNull() || value < result)) {
+				result = value;
+			}
+			break;
+		case StatisticsAggregateType::MAX:
+			if (!value.IsNull() && (result.IsNull() || value > result)) {
+				result = value;
+			}
+			break;
+		default:
+			throw InternalException("Unsupported StatisticsAggregateType");
+		}
+	}
+}
+
+Value StatisticsAggregateState::GetResult(idx_t aggregate_idx) {
+	lock_guard<mutex> l(lock);
+	return results[aggregate_idx];
+}
+
+} // namespace duckdb
@@ -9,8 +9,8 @@
 namespace duckdb {
 
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           ClientContext &context_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
 }
 
@@ -87,7 +87,7 @@ void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	    LossyNumericCast<idx_t>(MAXIMUM_MEMORY_LIMIT_RATIO * static_cast<double>(buffer_manager.GetMaxMemory()));
 	has_temporary_directory = buffer_manager.HasTemporaryDirectory();
 	num_threads = NumericCast<idx_t>(task_scheduler.NumberOfThreads());
-	query_max_memory = buffer_manager.GetQueryMaxMemory();
+	query_max_memory = buffer_manager.GetQueryMaxMemory(context);
 }
 
 TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
@@ -100,7 +100,8 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	minimum_reservation = MinValue(minimum_reservation, query_max_memory / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, context, minimum_reservation));
 	SetRemainingSize(*result, result->GetMinimumReservation());
 	SetReservation(*result, result->GetMinimumReservation());
 	active_states.insert(*result);
@@ -124,6 +125,17 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		SetReservation(temporary_memory_state, lower_bound);
 	} else if (!has_temporary_directory) {
 		// We cannot offload, so we cannot limit memory usage. Set reservation equal to the remaining size
+		// If the query of this client would exceed its own memory limit, we fail it instead of starving other queries
+		const auto query_memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+		const auto query_reservation =
+		    GetQueryReservation(temporary_memory_state) + temporary_memory_state.GetRemainingSize();
+		if (query_reservation > query_memory_limit) {
+			throw OutOfMemoryException(
+			    "Query requires %s of memory, which exceeds the query_memory_limit of %s, and there is no temporary "
+			    "directory to offload to",
+			    StringUtil::BytesToHumanReadableString(query_reservation),
+			    StringUtil::BytesToHumanReadableString(query_memory_limit));
+		}
 		SetReservation(temporary_memory_state, temporary_memory_state.GetRemainingSize());
 	} else if (reservation - temporary_memory_state.GetReservation() + lower_bound >= memory_limit) {
 		// We overshot. Set reservation equal to the minimum
@@ -131,9 +143,11 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 	} else {
 		// The upper bound for the reservation of this state is the minimum of:
 		// 1. Remaining size of the state
-		// 2. The max memory per query
+		// 2. The max memory per query, minus what the other states of the same query have reserved
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
-		auto upper_bound = MinValue<idx_t>(temporary_memory_state.GetRemainingSize(), query_max_memory);
+		const auto query_reservation = GetQueryReservation(temporary_memory_state);
+		const auto query_free_memory = query_max_memory > query_reservation ? query_max_memory - query_reservation : 0;
+		auto upper_bound = MinValue<idx_t>(temporary_memory_state.GetRemainingSize(), query_free_memory);
 		const auto free_memory = memory_limit - (reservation - temporary_memory_state.GetReservation());
 		upper_bound = MinValue<idx_t>(
 		    upper_bound, LossyNumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * static_cast<double>(free_memory)));
@@ -155,6 +169,17 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 	Verify();
 }
 
+idx_t TemporaryMemoryManager::GetQueryReservation(const TemporaryMemoryState &temporary_memory_state) const {
+	idx_t query_reservation = 0;
+	for (auto &active_state : active_states) {
+		if (!RefersToSameObject(active_state.get(), temporary_memory_state) &&
+		    RefersToSameObject(active_state.get().context, temporary_memory_state.context)) {
+			query_reservation += active_state.get().GetReservation();
+		}
+	}
+	return query_reservation;
+}
+
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
 	D_ASSERT(this->remaining_size >= temporary_memory_state.GetRemainingSize());
 	this->remaining_size -= temporary_memory_state.GetRemainingSize();
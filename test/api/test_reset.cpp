@@ -89,6 +89,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"perfect_ht_threshold", {0}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
+	    {"pin_threads", {"on"}},
 	    {"partitioned_write_flush_threshold", {123}},
 	    {"preserve_identifier_case", {false}},
 	    {"preserve_insertion_order", {false}},
@@ -96,6 +97,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"query_memory_limit", {"4.0 GiB"}},
 	    {"temp_directory", {"tmp"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -378,6 +379,15 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		//! Push the current value of the dynamic filter (if it has been set yet)
+		auto &dynamic_filter = filter->Cast<DynamicFilter>();
+		lock_guard<mutex> l(dynamic_filter.filter_data->lock);
+		if (!dynamic_filter.filter_data->initialized) {
+			return import_cache.pyarrow.dataset().attr("scalar")(true);
+		}
+		return TransformFilterRecursive(dynamic_filter.filter_data->filter.get(), column_ref, timezone_config, type);
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}